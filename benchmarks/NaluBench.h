@@ -0,0 +1,150 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef NaluBench_h
+#define NaluBench_h
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_topology/topology.hpp>
+#include <stk_util/environment/WallTime.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace nalu_bench {
+
+struct BenchOptions
+{
+  // cells per direction of the generated block
+  int meshSize_{16};
+
+  // timed repetitions; the best one is reported
+  int repeats_{5};
+
+  // relative perturbation of the interior nodes
+  double perturb_{0.1};
+
+  // in-partition entity order of the linear system meshes; none, morton, hilbert or rcm
+  std::string reorder_{"none"};
+
+  std::vector<stk::topology> topologies_;
+
+  // only run benchmarks whose name contains this string
+  std::string filter_;
+
+  // json output; stdout when empty
+  std::string outputFile_;
+};
+
+struct BenchResult
+{
+  std::string name_;
+  std::string topology_;
+
+  // global element count per repetition
+  size_t elements_{0};
+
+  // best wall time over the repetitions, slowest rank
+  double seconds_{0.0};
+
+  // global bytes moved and floating point operations per repetition;
+  // zero flops means no operation count model is available
+  double bytes_{0.0};
+  double flops_{0.0};
+};
+
+class BenchReport
+{
+public:
+  BenchReport(
+    const BenchOptions &options,
+    stk::ParallelMachine comm);
+
+  bool selected(const std::string &name) const;
+
+  void add(const BenchResult &result);
+
+  void write_json(std::ostream &os) const;
+
+  const BenchOptions &options_;
+  stk::ParallelMachine comm_;
+  std::vector<BenchResult> results_;
+};
+
+// wall time of the best of repeats calls, after one warm-up call; max over ranks
+template<typename LambdaFunction>
+double time_best(
+  stk::ParallelMachine comm,
+  const int repeats,
+  LambdaFunction lambdaFunc);
+
+double max_over_ranks(
+  stk::ParallelMachine comm,
+  const double localValue);
+
+double sum_over_ranks(
+  stk::ParallelMachine comm,
+  const double localValue);
+
+std::string topology_name(stk::topology topo);
+
+stk::topology topology_from_name(const std::string &name);
+
+/** Fill an uncommitted mesh with one "block_1" of the given topology
+ *
+ * A unit cube of n^3 cells, each split into hexahedra, tetrahedra (Kuhn
+ * split), wedges or pyramids (apex at the cell centre). Cells are
+ * distributed over the ranks in slabs along z. Interior nodes are moved by
+ * a deterministic perturbation, relative to the node spacing.
+ */
+void create_structured_mesh(
+  stk::mesh::BulkData &bulk,
+  stk::topology topo,
+  const int n,
+  const double perturb);
+
+size_t num_owned_elements(
+  const stk::mesh::BulkData &bulk);
+
+void run_master_element_benchmarks(
+  const BenchOptions &options,
+  BenchReport &report);
+
+void run_kernel_benchmarks(
+  const BenchOptions &options,
+  BenchReport &report);
+
+void run_linear_system_benchmarks(
+  const BenchOptions &options,
+  BenchReport &report);
+
+//--------------------------------------------------------------------------
+template<typename LambdaFunction>
+double time_best(
+  stk::ParallelMachine comm,
+  const int repeats,
+  LambdaFunction lambdaFunc)
+{
+  lambdaFunc();
+  double best = 0.0;
+  for ( int r = 0; r < repeats; ++r ) {
+    stk::parallel_machine_barrier(comm);
+    const double timeA = stk::wall_time();
+    lambdaFunc();
+    const double elapsed = max_over_ranks(comm, stk::wall_time() - timeA);
+    best = (r == 0) ? elapsed : std::min(best, elapsed);
+  }
+  return best;
+}
+
+} // namespace nalu_bench
+
+#endif
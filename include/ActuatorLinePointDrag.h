@@ -15,6 +15,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class PointCloudElementOperator;
 
 class ActuatorLinePointDragInfo {
 public:
@@ -44,14 +45,17 @@ class ActuatorLinePointDragPointInfo {
   double radius_;
   double omega_;
   double gaussDecayRadius_;
-  double bestX_;
-  stk::mesh::Entity bestElem_;
 
   // mesh motion specifics
   double velocity_[3];
+  double modelCoords_[3];
+  double lineCentroid_[3];
 
-  std::vector<double> isoParCoords_;
-  std::set<stk::mesh::Entity> nodeVec_;
+  // index in the point cloud operator
+  size_t pointIndex_;
+
+  // gaussian weights of the operator nodes; valid until the point moves
+  std::vector<double> spreadWeights_;
 };
 
  class ActuatorLinePointDrag: public Actuator
@@ -73,17 +77,11 @@ public:
   // setup part creation and nodal field registration (after populate_mesh())
   void initialize();
 
-  // determine element bounding box in the mesh
-  void populate_candidate_elements();
-
   // fill in the map that will hold point and ghosted elements
   void create_actuator_line_point_info_map();
 
-  // figure out the set of elements that belong in the custom ghosting data structure
-  void determine_elems_to_ghost();
-
-  // deal with custom ghosting
-  void manage_ghosting();
+  // rotate the points to the current time
+  void update_actuator_line_points();
 
   // manage rotation, now only in the y-z plane
   void set_current_coordinates(
@@ -91,9 +89,6 @@ public:
   void set_current_velocity(
     double *lineCentroid, const double *centroidCoords, double *velocity, const double &omega);
 
-  // populate vector of elements
-  void complete_search();
-
   // populate nodal field and output norms (if appropriate)
   void execute();
 
@@ -177,12 +172,13 @@ public:
   // Spread the actuator force to a node vector
   void spread_actuator_force_to_node_vec(
       const int &nDim,
-      std::set<stk::mesh::Entity>& nodeVec,
+      const std::vector<stk::mesh::Entity>& nodeVec,
       const std::vector<double>& actuator_force,
       const double * actuator_node_coordinates,
       const stk::mesh::FieldBase & coordinates,
       stk::mesh::FieldBase & actuator_source,
-      const double & epsilon);
+      const double & epsilon,
+      std::vector<double>& spreadWeights);
 
   // hold the realm
   Realm &realm_;
@@ -190,12 +186,8 @@ public:
   // type of stk search
   const stk::search::SearchMethod searchMethod_;
 
-  // custom ghosting
-  stk::mesh::Ghosting *actuatorLineGhosting_;
-
-  // how many elements to ghost?
-  uint64_t needToGhostCount_;
-  stk::mesh::EntityProcVec elemsToGhost_;
+  // cached search and custom ghosting of the points
+  PointCloudElementOperator *pointCloudOperator_;
 
   // local id for set of points
   uint64_t localPointId_;
@@ -206,13 +198,6 @@ public:
   // everyone needs pi
   const double pi_;
 
-  // save off product of search
-  std::vector<std::pair<theKey, theKey> > searchKeyPair_;
-
-  // bounding box data types for stk_search */
-  std::vector<boundingSphere> boundingSphereVec_;
-  std::vector<boundingElementBox> boundingElementBoxVec_;
-
   // target names for set of bounding boxes
   std::vector<std::string> searchTargetNames_;
 
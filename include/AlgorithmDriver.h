@@ -10,6 +10,7 @@
 #define AlgorithmDriver_h
 
 #include<Enums.h>
+#include<FieldUpdateTracker.h>
 
 #include<map>
 
@@ -31,8 +32,13 @@ public:
   virtual void execute();
   virtual void post_work(){};
 
+  // declaring an input makes execute() skip while all inputs are unchanged
+  void add_input_field(const stk::mesh::FieldBase *field) { fieldDependencies_.add_input(field); }
+  void add_output_field(const stk::mesh::FieldBase *field) { fieldDependencies_.add_output(field); }
+
   Realm &realm_;
   std::map<AlgorithmType, Algorithm *> algMap_;
+  FieldDependencies fieldDependencies_;
 };
 
 } // namespace nalu
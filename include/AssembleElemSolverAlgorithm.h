@@ -12,6 +12,7 @@
 #include<Realm.h>
 #include<SolverAlgorithm.h>
 #include<ElemDataRequests.h>
+#include<ElemGeometryCache.h>
 #include <KokkosInterface.h>
 #include <SimdInterface.h>
 #include<ScratchViews.h>
@@ -19,6 +20,8 @@
 #include<CopyAndInterleave.h>
 #include<FieldTypeDef.h>
 
+#include <memory>
+
 namespace stk {
 namespace mesh {
 class Part;
@@ -33,7 +36,8 @@ class MasterElement;
 
 int
 calculate_shared_mem_bytes_per_thread(int lhsSize, int rhsSize, int scratchIdsSize, int nDim,
-                                      ElemDataRequests& dataNeededByKernels);
+                                      ElemDataRequests& dataNeededByKernels,
+                                      bool leanScratch);
 
 class AssembleElemSolverAlgorithm : public SolverAlgorithm
 {
@@ -45,10 +49,39 @@ public:
     stk::mesh::EntityRank entityRank,
     unsigned nodesPerEntity,
     bool interleaveMeViews = true);
-  virtual ~AssembleElemSolverAlgorithm() {}
+  virtual ~AssembleElemSolverAlgorithm();
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // report default and lean scratch sizes once per algorithm
+  void report_shared_mem_bytes(const int nDim);
+
+  /** Kernel vector for contributions that vanish away from the VOF interface;
+   *  when the interface band is active these only run on simd groups that
+   *  touch the band, otherwise they are simply part of activeKernels_
+   */
+  std::vector<Kernel*>& get_interface_kernels()
+  {
+    return (nullptr != interfaceBand_) ? interfaceKernels_ : activeKernels_;
+  }
+
+  bool in_interface_band(
+    const stk::mesh::Bucket& b,
+    const size_t offset,
+    const int numSimdElems) const
+  {
+    if ( nullptr == interfaceBand_ )
+      return true;
+    const double* band = stk::mesh::field_data(*interfaceBand_, b);
+    if ( nullptr == band )
+      return true;
+    for ( int simdElemIndex = 0; simdElemIndex < numSimdElems; ++simdElemIndex ) {
+      if ( band[offset+simdElemIndex] > 0.0 )
+        return true;
+    }
+    return false;
+  }
+
   template<typename LambdaFunction>
   void run_algorithm(stk::mesh::BulkData& bulk_data, LambdaFunction lambdaFunc)
   {
@@ -58,7 +91,11 @@ public:
 
    const int bytes_per_team = 0;
    const int bytes_per_thread = calculate_shared_mem_bytes_per_thread(lhsSize, rhsSize_, scratchIdsSize,
-                                                                    meta_data.spatial_dimension(), dataNeededByKernels_);
+                                                                    meta_data.spatial_dimension(), dataNeededByKernels_,
+                                                                    leanScratch_);
+   if ( !scratchReported_ )
+     report_shared_mem_bytes(meta_data.spatial_dimension());
+
    stk::mesh::Selector elemSelector =
            meta_data.locally_owned_part()
          & stk::mesh::selectUnion(partVec_)
@@ -67,6 +104,10 @@ public:
    stk::mesh::BucketVector const& elem_buckets =
            realm_.get_buckets(entityRank_, elemSelector );
  
+   // serial; invalidate cached geometry on mesh modification or motion
+   if ( geometryCache_ )
+     geometryCache_->begin_execute(dataNeededByKernels_, bulk_data, entityRank_, realm_.geometryUpdateCount_);
+
    auto team_exec = sierra::nalu::get_team_policy(elem_buckets.size(), bytes_per_team, bytes_per_thread);
    Kokkos::parallel_for(team_exec, [&](const sierra::nalu::TeamHandleType& team)
    {
@@ -76,29 +117,60 @@ public:
                     "AssembleElemSolverAlgorithm expected nodesPerEntity_ = "
                     <<nodesPerEntity_<<", but b.topology().num_nodes() = "<<b.topology().num_nodes());
  
-     SharedMemData smdata(team, bulk_data, dataNeededByKernels_, nodesPerEntity_, rhsSize_);
+     SharedMemData smdata(team, bulk_data, dataNeededByKernels_, nodesPerEntity_, rhsSize_, leanScratch_);
 
      const size_t bucketLen   = b.size();
      const size_t simdBucketLen = get_num_simd_groups(bucketLen);
+
+     if ( geometryCache_ ) {
+       Kokkos::single(Kokkos::PerTeam(team), [&]() {
+         geometryCache_->prepare_bucket(b, smdata.simdPrereqData);
+       });
+       team.team_barrier();
+     }
  
      Kokkos::parallel_for(Kokkos::TeamThreadRange(team, simdBucketLen), [&](const size_t& bktIndex)
      {
        int numSimdElems = get_length_of_next_simd_group(bktIndex, bucketLen);
        smdata.numSimdElems = numSimdElems;
+
+       // groups away from the interface band have nothing to do when only band kernels are active
+       smdata.inInterfaceBand = in_interface_band(b, bktIndex*simdLen, numSimdElems);
+       if ( !smdata.inInterfaceBand && activeKernels_.empty() )
+         return;
  
-       for(int simdElemIndex=0; simdElemIndex<numSimdElems; ++simdElemIndex) {
-         stk::mesh::Entity element = b[bktIndex*simdLen + simdElemIndex];
-         smdata.elemNodes[simdElemIndex] = bulk_data.begin_nodes(element);
-         fill_pre_req_data(dataNeededByKernels_, bulk_data, element,
-                           *smdata.prereqData[simdElemIndex], interleaveMEViews_);
+       // cached geometry is restored rather than recomputed
+       const bool geometryIsCached = geometryCache_ && geometryCache_->is_cached(b, bktIndex);
+       ElemDataRequests& dataNeeded = geometryIsCached
+         ? geometryCache_->recompute_requests() : dataNeededByKernels_;
+
+       if ( leanScratch_ ) {
+         for(int simdElemIndex=0; simdElemIndex<numSimdElems; ++simdElemIndex) {
+           stk::mesh::Entity element = b[bktIndex*simdLen + simdElemIndex];
+           smdata.elemNodes[simdElemIndex] = bulk_data.begin_nodes(element);
+           fill_pre_req_data(dataNeeded, bulk_data, element, smdata.simdPrereqData, simdElemIndex);
+         }
+       }
+       else {
+         for(int simdElemIndex=0; simdElemIndex<numSimdElems; ++simdElemIndex) {
+           stk::mesh::Entity element = b[bktIndex*simdLen + simdElemIndex];
+           smdata.elemNodes[simdElemIndex] = bulk_data.begin_nodes(element);
+           fill_pre_req_data(dataNeeded, bulk_data, element,
+                             *smdata.prereqData[simdElemIndex], interleaveMEViews_);
+         }
+
+         copy_and_interleave(smdata.prereqData, numSimdElems, smdata.simdPrereqData, interleaveMEViews_);
        }
- 
-       copy_and_interleave(smdata.prereqData, numSimdElems, smdata.simdPrereqData, interleaveMEViews_);
  
        if (!interleaveMEViews_) {
-         fill_master_element_views(dataNeededByKernels_, bulk_data, smdata.simdPrereqData);
+         fill_master_element_views(dataNeeded, bulk_data, smdata.simdPrereqData);
        }
 
+       if ( geometryIsCached )
+         geometryCache_->restore(b, bktIndex, smdata.simdPrereqData);
+       else if ( geometryCache_ )
+         geometryCache_->store(b, bktIndex, smdata.simdPrereqData);
+
        lambdaFunc(smdata);
      });
    });
@@ -109,6 +181,17 @@ public:
   unsigned nodesPerEntity_;
   int rhsSize_;
   const bool interleaveMEViews_;
+
+  // gather directly into the simd views; only valid when master element views are not interleaved
+  bool leanScratch_;
+  bool scratchReported_;
+
+  // element flag (> 0 within the band); null when the interface band is not active
+  ScalarFieldType *interfaceBand_;
+  std::vector<Kernel*> interfaceKernels_;
+
+  // opt-in cache of master element geometry; null unless element_geometry_cache is specified
+  std::unique_ptr<ElemGeometryCache> geometryCache_;
 };
 
 } // namespace nalu
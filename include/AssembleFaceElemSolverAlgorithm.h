@@ -41,6 +41,9 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // report default and lean scratch sizes once per algorithm
+  void report_shared_mem_bytes(const int defaultBytes, const int leanBytes);
+
   template<typename LambdaFunction>
   void run_face_elem_algorithm(stk::mesh::BulkData& bulk, LambdaFunction lamdbaFunc)
   {
@@ -66,7 +69,15 @@ public:
 
       const int bytes_per_team = 0;
       const int bytes_per_thread = calculate_shared_mem_bytes_per_thread(lhsSize, rhsSize, scratchIdsSize,
-                                                                       nDim, faceDataNeeded_, elemDataNeeded_, meElemInfo);
+                                                                       nDim, faceDataNeeded_, elemDataNeeded_, meElemInfo,
+                                                                       leanScratch_);
+      if (!scratchReported_) {
+        report_shared_mem_bytes(
+          calculate_shared_mem_bytes_per_thread(lhsSize, rhsSize, scratchIdsSize, nDim,
+                                                faceDataNeeded_, elemDataNeeded_, meElemInfo, false),
+          calculate_shared_mem_bytes_per_thread(lhsSize, rhsSize, scratchIdsSize, nDim,
+                                                faceDataNeeded_, elemDataNeeded_, meElemInfo, true));
+      }
 
       const bool interleaveMeViews = false;
 
@@ -84,7 +95,7 @@ public:
                        "AssembleFaceElemSolverAlgorithm expected nodesPerEntity_ = "
                        <<nodesPerFace_<<", but b.topology().num_nodes() = "<<b.topology().num_nodes());
 
-        SharedMemData_FaceElem smdata(team, bulk, faceDataNeeded_, elemDataNeeded_, meElemInfo, rhsSize);
+        SharedMemData_FaceElem smdata(team, bulk, faceDataNeeded_, elemDataNeeded_, meElemInfo, rhsSize, leanScratch_);
 
         const size_t bucketLen   = b.size();
         const size_t simdBucketLen = sierra::nalu::get_num_simd_groups(bucketLen);
@@ -110,15 +121,23 @@ public:
               smdata.connectedNodes[simdFaceIndex] = bulk.begin_nodes(elems[0]);
               smdata.elemFaceOrdinal = thisElemFaceOrdinal;
               elemFaceOrdinal = thisElemFaceOrdinal;
-              sierra::nalu::fill_pre_req_data(faceDataNeeded_, bulk, face, *smdata.faceViews[simdFaceIndex], interleaveMeViews);
-              sierra::nalu::fill_pre_req_data(elemDataNeeded_, bulk, elems[0], *smdata.elemViews[simdFaceIndex], interleaveMeViews);
+              if (leanScratch_) {
+                sierra::nalu::fill_pre_req_data(faceDataNeeded_, bulk, face, smdata.simdFaceViews, simdFaceIndex);
+                sierra::nalu::fill_pre_req_data(elemDataNeeded_, bulk, elems[0], smdata.simdElemViews, simdFaceIndex);
+              }
+              else {
+                sierra::nalu::fill_pre_req_data(faceDataNeeded_, bulk, face, *smdata.faceViews[simdFaceIndex], interleaveMeViews);
+                sierra::nalu::fill_pre_req_data(elemDataNeeded_, bulk, elems[0], *smdata.elemViews[simdFaceIndex], interleaveMeViews);
+              }
               ++simdFaceIndex;
             }
             smdata.numSimdFaces = simdFaceIndex;
             numFacesProcessed += simdFaceIndex;
   
-            copy_and_interleave(smdata.faceViews, smdata.numSimdFaces, smdata.simdFaceViews, interleaveMeViews);
-            copy_and_interleave(smdata.elemViews, smdata.numSimdFaces, smdata.simdElemViews, interleaveMeViews);
+            if (!leanScratch_) {
+              copy_and_interleave(smdata.faceViews, smdata.numSimdFaces, smdata.simdFaceViews, interleaveMeViews);
+              copy_and_interleave(smdata.elemViews, smdata.numSimdFaces, smdata.simdElemViews, interleaveMeViews);
+            }
             fill_master_element_views(faceDataNeeded_, bulk, smdata.simdFaceViews, smdata.elemFaceOrdinal);
             fill_master_element_views(elemDataNeeded_, bulk, smdata.simdElemViews, smdata.elemFaceOrdinal);
   
@@ -135,6 +154,10 @@ public:
   unsigned nodesPerElem_;
   int rhsSize_;
   const bool interleaveMEViews_;
+
+  // gather directly into the simd views rather than through per-lane scalar views
+  bool leanScratch_;
+  bool scratchReported_;
 };
 
 } // namespace nalu
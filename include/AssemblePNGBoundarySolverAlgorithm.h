@@ -22,6 +22,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class ProjectedNodalGradientEquationSystem;
 
 class AssemblePNGBoundarySolverAlgorithm : public SolverAlgorithm
 {
@@ -30,12 +31,15 @@ public:
   AssemblePNGBoundarySolverAlgorithm(
     Realm &realm,
     stk::mesh::Part *part,
-    EquationSystem *eqSystem,
+    ProjectedNodalGradientEquationSystem *eqSystem,
     std::string independentDofName);
   virtual ~AssemblePNGBoundarySolverAlgorithm() {}
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // provides the active right-hand side component
+  const ProjectedNodalGradientEquationSystem *pngEqSystem_;
+
   ScalarFieldType *scalarQ_;
   GenericFieldType *exposedAreaVec_;
 };
@@ -22,6 +22,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class ProjectedNodalGradientEquationSystem;
 
 class AssemblePNGElemSolverAlgorithm : public SolverAlgorithm
 {
@@ -30,13 +31,16 @@ public:
   AssemblePNGElemSolverAlgorithm(
     Realm &realm,
     stk::mesh::Part *part,
-    EquationSystem *eqSystem,
+    ProjectedNodalGradientEquationSystem *eqSystem,
     std::string independentDofName,
     std::string dofName);
   virtual ~AssemblePNGElemSolverAlgorithm() {}
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // provides the active right-hand side component
+  const ProjectedNodalGradientEquationSystem *pngEqSystem_;
+
   ScalarFieldType *scalarQ_;
   VectorFieldType *dqdx_;
   VectorFieldType *coordinates_;
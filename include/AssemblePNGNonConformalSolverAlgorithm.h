@@ -19,6 +19,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class ProjectedNodalGradientEquationSystem;
 
 class AssemblePNGNonConformalSolverAlgorithm : public SolverAlgorithm
 {
@@ -27,7 +28,7 @@ public:
   AssemblePNGNonConformalSolverAlgorithm(
     Realm &realm,
     stk::mesh::Part *part,
-    EquationSystem *eqSystem,
+    ProjectedNodalGradientEquationSystem *eqSystem,
     std::string independentDofName,
     std::string dofName,
     const bool includePenalty);
@@ -37,6 +38,9 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // provides the active right-hand side component
+  const ProjectedNodalGradientEquationSystem *pngEqSystem_;
+
   ScalarFieldType *scalarQ_;
   VectorFieldType *Gjq_;
   VectorFieldType *coordinates_;
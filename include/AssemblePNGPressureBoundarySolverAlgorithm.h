@@ -22,6 +22,7 @@ namespace sierra{
 namespace nalu{
 
 class Realm;
+class ProjectedNodalGradientEquationSystem;
 
 class AssemblePNGPressureBoundarySolverAlgorithm : public SolverAlgorithm
 {
@@ -30,12 +31,15 @@ public:
   AssemblePNGPressureBoundarySolverAlgorithm(
     Realm &realm,
     stk::mesh::Part *part,
-    EquationSystem *eqSystem,
+    ProjectedNodalGradientEquationSystem *eqSystem,
     std::string independentDofName);
   virtual ~AssemblePNGPressureBoundarySolverAlgorithm() {}
   virtual void initialize_connectivity();
   virtual void execute();
 
+  // provides the active right-hand side component
+  const ProjectedNodalGradientEquationSystem *pngEqSystem_;
+
   ScalarFieldType *scalarQ_;
   GenericFieldType *dynamicP_;
   GenericFieldType *exposedAreaVec_;
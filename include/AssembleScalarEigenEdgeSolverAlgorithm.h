@@ -13,6 +13,8 @@
 #include<FieldTypeDef.h>
 #include<EigenDecomposition.h>
 
+#include <vector>
+
 namespace stk {
 namespace mesh {
 class Part;
@@ -90,6 +92,12 @@ public:
   double D_[3][3];
   double Q_[3][3];
   int rowMap_[3];
+
+  // per-bucket scratch for the batched decomposition
+  std::vector<double> bBatch_;
+  std::vector<double> lambdaBatch_;
+  std::vector<double> QBatch_;
+  std::vector<double> timeScaleBatch_;
 };
 
 } // namespace nalu
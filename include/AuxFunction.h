@@ -12,6 +12,13 @@
 namespace sierra{
 namespace nalu{
 
+// how the values of an AuxFunction change with time; lets the caller reuse them
+enum AuxFunctionTimeDependence {
+  AUX_TIME_GENERAL   = 0, // f(x,t); evaluated on every call
+  AUX_TIME_SEPARABLE = 1, // f(x,t) = g(x)*time_factor(t)
+  AUX_TIME_STATIC    = 2  // f(x)
+};
+
 class AuxFunction
 {
 public:
@@ -57,6 +64,14 @@ public:
   }
   virtual void setup(const double time) {}
 
+  // functions that do not depend on time in general should say so
+  virtual AuxFunctionTimeDependence time_dependence() const { return AUX_TIME_GENERAL; }
+
+  // separable functions only; the scaling of the values at time relative to
+  // their spatial shape, and a time at which that scaling is nonzero
+  virtual double time_factor(const double /*time*/) const { return 1.0; }
+  virtual double reference_time() const { return 0.0; }
+
 private:
 
   // Derived classes must at_least implement this method
@@ -9,6 +9,7 @@
 #define AuxFunctionAlgorithm_h
 
 #include <Algorithm.h>
+#include <AuxFunction.h>
 
 #include <vector>
 #include <stk_mesh/base/Types.hpp>
@@ -26,8 +27,6 @@ typedef std::vector< Part * > PartVector;
 namespace sierra{
 namespace nalu{
 
-class AuxFunction;
-
 class AuxFunctionAlgorithm : public Algorithm
 {
 public:
@@ -44,13 +43,40 @@ public:
   virtual ~AuxFunctionAlgorithm();
   virtual void execute();
 
+  stk::mesh::FieldBase * field() const { return field_; }
+
+  // a constant function gives the same values on every execution
+  bool is_constant() const;
+
+  // time dependence of the function as seen on this mesh; moving meshes are general
+  AuxFunctionTimeDependence time_dependence() const;
+
+  // evaluation counts and estimated time saved by reusing cached values
+  void dump_time() const;
+
 private:
+  // cached values describe the current mesh and coordinates
+  bool cache_is_current(const stk::mesh::BucketVector & buckets) const;
+
   stk::mesh::FieldBase * field_;
   AuxFunction *auxFunction_;
   stk::mesh::EntityRank entityRank_;
   const bool parallelCommunicate_;
   const bool periodicCommunicate_;
 
+  // values of static and separable functions per bucket; separable values
+  // are held at the reference time, i.e., scaled by cacheTimeFactor_
+  std::vector<std::vector<double> > cache_;
+  size_t cacheSyncCount_;
+  size_t cacheGeometryCount_;
+  double cacheTimeFactor_;
+
+  // full evaluations vs. reuses of the cache
+  double timerEvaluate_;
+  double timerReuse_;
+  size_t numEvaluate_;
+  size_t numReuse_;
+
 private:
   // make this non-copyable
   AuxFunctionAlgorithm(const AuxFunctionAlgorithm & other);
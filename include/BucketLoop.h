@@ -7,10 +7,16 @@
 #ifndef BucketLoop_h
 #define BucketLoop_h
 
+#include <KokkosInterface.h>
+
 #include <stk_mesh/base/Bucket.hpp>
 
+#include <vector>
+
 namespace sierra { namespace nalu {
 
+  using HostExecSpace = Kokkos::DefaultHostExecutionSpace;
+
   template<class LOOP_BODY>
   void bucket_loop(const stk::mesh::BucketVector& buckets, LOOP_BODY inner_loop_body)
   {
@@ -22,6 +28,38 @@ namespace sierra { namespace nalu {
     }
   }
 
+  // threaded loop with one bucket per work item; the body sees the whole
+  // bucket so that its loop over the (contiguous) field data vectorizes
+  template<class BUCKET_BODY>
+  void parallel_bucket_loop(const stk::mesh::BucketVector& buckets, const BUCKET_BODY& bucket_body)
+  {
+    Kokkos::parallel_for(Kokkos::RangePolicy<HostExecSpace>(0, buckets.size()), [&](const size_t ib) {
+      bucket_body(*buckets[ib]);
+    });
+  }
+
+  // threaded reduction; every bucket reduces into its own partial (starting
+  // from init) and the partials are joined in bucket order, so the result
+  // does not depend on the number of threads
+  template<typename ValueType, class BUCKET_BODY, class JOIN>
+  ValueType parallel_bucket_reduce(
+    const stk::mesh::BucketVector& buckets,
+    const ValueType& init,
+    const BUCKET_BODY& bucket_body,
+    const JOIN& join)
+  {
+    std::vector<ValueType> partials(buckets.size(), init);
+    Kokkos::parallel_for(Kokkos::RangePolicy<HostExecSpace>(0, buckets.size()), [&](const size_t ib) {
+      bucket_body(*buckets[ib], partials[ib]);
+    });
+
+    ValueType result = init;
+    for (const ValueType& partial : partials) {
+      join(result, partial);
+    }
+    return result;
+  }
+
 }}
 
 #endif
@@ -32,11 +32,6 @@ public:
 
   void execute();
 
-  void compute_utau(
-      const double &up, const double &yp,
-      const double &density, const double &viscosity,
-      double &utau);
-
   const bool useShifted_;
   const double yplusCrit_;
   const double elog_;
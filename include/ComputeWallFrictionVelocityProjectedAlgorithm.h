@@ -55,11 +55,6 @@ public:
   void set_data_alt( 
     double theDouble);
 
-  void compute_utau(
-      const double &up, const double &yp,
-      const double &density, const double &viscosity,
-      double &utau, bool &converged);
-
   void compute_utau_ode(
       const double &uTan, const double &uWall, const double &rhoWall, 
       const double &muWall, PointInfo *pInfo, double &utau, bool &converged);
@@ -69,6 +64,9 @@ public:
   
   // ghosting and initialization set of calls
   void initialize();
+
+  // follow mesh motion within the owning elements; false when a search is needed
+  bool update_projection();
   void initialize_ghosting();
   void construct_bounding_points();
   void initialize_map();
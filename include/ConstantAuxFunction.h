@@ -36,6 +36,8 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  virtual AuxFunctionTimeDependence time_dependence() const { return AUX_TIME_STATIC; }
   
 private:
   const std::vector<double> values_;
@@ -34,6 +34,8 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node);
+
+  virtual bool is_thread_safe() const { return true; }
   
   ScalarFieldType *densityN_;
   ScalarFieldType *densityNp1_;
@@ -13,11 +13,19 @@
 // Includes and forwards
 //==============================================================================
 
+#include <FieldTypeDef.h>
+
 #include <stk_mesh/base/Entity.hpp>
 #include <stk_topology/topology.hpp>
 
 #include <vector>
 
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
 namespace sierra {
 namespace nalu {
 
@@ -59,6 +67,16 @@ class DgInfo {
 
   void dump_info();
 
+  // gauss point operators that depend on the geometry of the search only
+  void compute_interface_operators(
+    const stk::mesh::BulkData &bulk,
+    const VectorFieldType &coordinates,
+    const size_t geometryUpdateCount);
+
+  bool interface_operators_current(const size_t geometryUpdateCount) const {
+    return hasInterfaceOperators_ && geometryUpdateCount == operatorGeometryUpdateCount_;
+  }
+
   int parallelRank_;
   uint64_t globalFaceId_;
   uint64_t localGaussPointId_;
@@ -110,6 +128,25 @@ class DgInfo {
   // possible reuse
   std::vector<uint64_t> allOpposingFaceIds_;
   std::vector<uint64_t> allOpposingFaceIdsOld_;
+
+  // interface operators; computed after the search, recomputed when the geometry changes
+  bool hasInterfaceOperators_;
+  size_t operatorGeometryUpdateCount_;
+
+  // iso-parametric coordinates for gauss point on current/opposing element (CVFEM range)
+  std::vector<double> currentElementIsoParCoords_;
+  std::vector<double> opposingElementIsoParCoords_;
+
+  // face shape functions at the gauss point
+  std::vector<double> currentFaceShapeFcn_;
+  std::vector<double> opposingFaceShapeFcn_;
+
+  // element gradient operators at the gauss point, node-major
+  std::vector<double> currentElementDndx_;
+  std::vector<double> opposingElementDndx_;
+
+  // unit normal of the opposing face at the gauss point
+  std::vector<double> opposingNormal_;
 };
   
 } // end sierra namespace
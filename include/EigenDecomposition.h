@@ -32,6 +32,18 @@ namespace EigenDecomposition
   void matrix_matrix_multiply(const DoubleType (&D)[2][2], const DoubleType (&Q)[2][2], DoubleType (&A)[2][2]);
   void matrix_matrix_multiply(const DoubleType (&D)[3][3], const DoubleType (&Q)[3][3], DoubleType (&A)[3][3]);
 
+  // closed-form (trigonometric) eigenvalues and cross-product eigenvectors; lanes
+  // with (nearly) repeated eigenvalues fall back to the Jacobi iteration
+  void sym_diagonalize_closed_form(const DoubleType (&A)[3][3], DoubleType (&Q)[3][3], DoubleType (&D)[3][3]);
+
+  /** Batched decomposition of numTensors symmetric 3x3 tensors, simdLen at a time
+   *
+   * Structure of arrays, each with stride numTensors: A holds the components
+   * xx, yy, zz, xy, xz, yz; lambda the three eigenvalues and Q the entries
+   * Q[i][j] in row-major order, such that A = Q*diag(lambda)*QT.
+   */
+  void sym_diagonalize_batch(const int numTensors, const double *A, double *lambda, double *Q);
+
 }
 
 } // namespace nalu
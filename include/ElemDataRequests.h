@@ -100,6 +100,13 @@ public:
     dataEnums[cType].insert(data);
   }
 
+  void remove_master_element_call(
+    ELEM_DATA_NEEDED data,
+    COORDS_TYPES cType = CURRENT_COORDINATES)
+  {
+    dataEnums[cType].erase(data);
+  }
+
   void add_gathered_nodal_field(const stk::mesh::FieldBase& field, unsigned scalarsPerNode);
 
   void add_gathered_nodal_field(const stk::mesh::FieldBase& field, unsigned tensorDim1, unsigned tensorDim2);
@@ -0,0 +1,102 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ElemGeometryCache_h
+#define ElemGeometryCache_h
+
+#include <ElemDataRequests.h>
+#include <ScratchViews.h>
+#include <SimdInterface.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/Bucket.hpp>
+
+#include <array>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** Per-bucket cache of interleaved (SIMD) master element geometry
+ *
+ * Stores the requested master element views, e.g., scs_areav or dndx, for
+ * every SIMD group of elements the first time they are computed. Subsequent
+ * assembly passes restore the views from the cache and only recompute the
+ * master element data that is not cached. The cache is rebuilt whenever the
+ * mesh is modified or the realm geometry is recomputed (mesh motion).
+ */
+class ElemGeometryCache
+{
+public:
+  ElemGeometryCache(
+    const std::vector<std::string>& cachedNames);
+  ~ElemGeometryCache() {}
+
+  // serial; prepare storage prior to the threaded bucket loop
+  void begin_execute(
+    const ElemDataRequests& dataNeeded,
+    const stk::mesh::BulkData& bulkData,
+    const stk::mesh::EntityRank entityRank,
+    const size_t geometryUpdateCount);
+
+  bool is_cached(
+    const stk::mesh::Bucket& b,
+    const size_t simdGroup) const
+  {
+    const std::vector<char>& groupFlags = groupIsCached_[b.bucket_id()];
+    return simdGroup < groupFlags.size() && groupFlags[simdGroup];
+  }
+
+  // size the storage of a bucket; called by a single thread of the owning team
+  void prepare_bucket(
+    const stk::mesh::Bucket& b,
+    ScratchViews<DoubleType>& simdViews);
+
+  void store(
+    const stk::mesh::Bucket& b,
+    const size_t simdGroup,
+    ScratchViews<DoubleType>& simdViews);
+
+  void restore(
+    const stk::mesh::Bucket& b,
+    const size_t simdGroup,
+    ScratchViews<DoubleType>& simdViews) const;
+
+  // data requests with the cached master element calls removed
+  ElemDataRequests& recompute_requests() { return recomputeData_; }
+
+  // master element calls that are provided by the cache
+  const std::set<ELEM_DATA_NEEDED>& cached_enums(const COORDS_TYPES cType) const
+  { return cachedEnums_[cType]; }
+
+  size_t size_in_bytes() const;
+
+private:
+  void setup(const ElemDataRequests& dataNeeded);
+
+  size_t group_length(ScratchViews<DoubleType>& simdViews) const;
+
+  std::set<ELEM_DATA_NEEDED> requestedEnums_;
+  std::array<std::set<ELEM_DATA_NEEDED>, MAX_COORDS_TYPES> cachedEnums_;
+  ElemDataRequests recomputeData_;
+  bool isSetup_;
+
+  size_t geometryUpdateCount_;
+  size_t syncCount_;
+  bool reported_;
+
+  std::vector<std::vector<DoubleType>> bucketData_;
+  std::vector<std::vector<char>> groupIsCached_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
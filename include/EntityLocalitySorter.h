@@ -0,0 +1,89 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef EntityLocalitySorter_h
+#define EntityLocalitySorter_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+#include <stk_mesh/base/EntitySorterBase.hpp>
+#include <stk_mesh/base/Selector.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+// space filling curve index of a point on a 2^bits lattice; nDim*bits <= 64
+uint64_t morton_key(const uint32_t *coords, const int nDim, const int bits);
+uint64_t hilbert_key(const uint32_t *coords, const int nDim, const int bits);
+
+//=============================================================================
+// Class Definition
+//=============================================================================
+// EntityLocalitySorter
+//=============================================================================
+/**
+ * @par Description:
+ * - Class that sorts nodes, edges and elements within each partition for
+ *   spatial locality; supported types are "morton", "hilbert" and "rcm".
+ *
+ * @par Design Considerations:
+ * - Keys are computed once for all local entities, indexed by local offset.
+ *   Curve keys use the node coordinates (edges and elements their
+ *   centroid) on the local bounding box; "rcm" numbers the nodes by reverse
+ *   Cuthill-McKee on the local node graph and edges and elements by their
+ *   lowest node. Sides keep their order (see EntityExposedFaceSorter).
+ * - Matrix rows are numbered in bucket order, so the node order is the
+ *   local row order of the linear systems.
+ */
+//=============================================================================
+
+class EntityLocalitySorter : public stk::mesh::EntitySorterBase {
+
+public:
+  EntityLocalitySorter(
+    const stk::mesh::BulkData &bulk,
+    const VectorFieldType &coordinates,
+    const std::string &type);
+
+  virtual ~EntityLocalitySorter() {}
+
+  virtual void sort(stk::mesh::BulkData &bulk, stk::mesh::EntityVector& entityVector) const;
+
+  static bool is_supported(const std::string &type);
+
+  /** Bandwidth of the node graph of the selected nodes, in bucket order
+   *
+   * Returns the maximum and the row-averaged distance between the positions
+   * of two nodes that share an element.
+   */
+  static std::pair<size_t, double> node_bandwidth(
+    const stk::mesh::BulkData &bulk,
+    const stk::mesh::Selector &selector);
+
+private:
+  void compute_curve_keys(
+    const stk::mesh::BulkData &bulk,
+    const VectorFieldType &coordinates,
+    const bool useHilbert);
+
+  void compute_rcm_keys(
+    const stk::mesh::BulkData &bulk);
+
+  std::vector<uint64_t> key_;
+};
+
+} // end sierra namespace
+} // end nalu namespace
+
+#endif
@@ -73,6 +73,7 @@ enum EquationType {
   EQ_PNG_U = 17,
   EQ_PNG_TKE = 18, // FIXME... Last PNG managed like this..
   EQ_UVWP = 19,
+  EQ_WALL_DISTANCE = 20,
   EquationSystemType_END
 };
 
@@ -96,7 +97,8 @@ static const std::string EquationTypeMap[] = {
   "PNG_H",
   "PNG_U",
   "PNG_TKE",
-  "MOMENTUM_CONTINUITY"
+  "MOMENTUM_CONTINUITY",
+  "Wall_Distance"
 };
 
 enum UserDataType {
@@ -58,6 +58,7 @@ ExplicitFilteringFields(stk::mesh::Field<double> *theField, stk::mesh::Field<dou
 };
  
 class Realm;
+class PointCloudElementOperator;
 
 class ExplicitFiltering
 {
@@ -78,20 +79,11 @@ public:
   // setup part creation and nodal field registration (after populate_mesh())
   void initialize();
 
-  // determine element bounding box in the mesh
-  void populate_candidate_elements();
-
-  // fill in the map that will hold point and ghosted elements
+  // register a filter box about each node with the point cloud operator
   void create_explicit_filter_point_info_map();
 
-  // figure out the set of elements that belong in the custom ghosting data structure
-  void determine_elems_to_ghost();
-
-  // deal with custom ghosting
-  void manage_ghosting();
-
-  // populate vector of elements
-  void complete_search();
+  // precompute the filter as a sparse nodal operator
+  void build_filter_operator();
 
   // populate nodal field and output norms (if appropriate)
   void execute();
@@ -110,14 +102,6 @@ public:
     stk::mesh::Entity elem,
     const stk::mesh::BulkData & bulkData);
 
-  void increment_elem_mean(
-    const int &sizeOfField,
-    double *fieldToFill,
-    const stk::mesh::FieldBase &stkField,
-    stk::mesh::Entity const* elem_node_rels,
-    const int &nodesPerElement,
-    const double &elemVolume);
-
   void compute_scv_residual(
     const stk::mesh::FieldBase *velocityNp1_,
     const stk::mesh::FieldBase *velocityN_,
@@ -140,11 +124,8 @@ public:
   // the size of the filter
   Coordinates filterSize_;
 
-  // custom ghosting
-  stk::mesh::Ghosting *explicitFilteringGhosting_;
-
-  // how many elements to ghost?
-  uint64_t needToGhostCount_;
+  // cached search and custom ghosting of the filter boxes
+  PointCloudElementOperator *pointCloudOperator_;
 
   // provide debug output
   bool debugOutput_;
@@ -160,24 +141,20 @@ public:
   std::vector<ExplicitFilteringFields> explicitFilteringFieldsVec_;
   std::vector<ExplicitFilteringFields> residualFieldsVec_;
 
-  // vector of elements/poit processor to ghost
-  stk::mesh::EntityProcVec elemsToGhost_;
-
-  // save off product of search
-  std::vector<std::pair<theKey, theKey> > searchKeyPair_;
-
-  // bounding box data types for stk_search */
-  std::vector<boundingElementBox> boundingFilterVec_;
-  std::vector<boundingElementBox> boundingElementBoxVec_;
-
   // target names for set of bounding boxes
   std::vector<std::string> searchTargetNames_;
 
   // corresponding parts for targets
   stk::mesh::PartVector searchParts_;
 
-  // map of point info objects to vector of element entities
-  std::map<stk::mesh::Entity, std::vector<stk::mesh::Entity> > explicitFilteringMap_;
+  // filtered node of each operator point
+  std::vector<stk::mesh::Entity> filterNodes_;
+
+  // sparse filter operator; per row, the filter volume and the volume weights of the donor nodes
+  std::vector<double> filterVolume_;
+  std::vector<size_t> filterRowPtr_;
+  std::vector<stk::mesh::Entity> filterColNodes_;
+  std::vector<double> filterColWeights_;
 
   // scratch space
   std::vector<double> ws_coordinates_;
@@ -0,0 +1,121 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ExternalFieldReader_h
+#define ExternalFieldReader_h
+
+#include <stk_mesh/base/Entity.hpp>
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+/** Streaming reader for nodal fields of an external field provider realm
+ *
+ * stk's read_defined_input_fields re-reads both bracketing database steps
+ * on every call. This reader keeps the bracketing snapshots in a small ring
+ * buffer, interpolates linearly in time in memory (or snaps to the closest
+ * step) and, optionally, reads the next database step on a background
+ * thread while the solver advances. Background reads call into Ioss, which
+ * may communicate, so they are only enabled when MPI provides
+ * MPI_THREAD_MULTIPLE; otherwise the reads are synchronous. They also
+ * require thread-safe builds of the I/O libraries (netCDF/HDF5) since
+ * output may be written concurrently by the main thread.
+ */
+class ExternalFieldReader
+{
+public:
+  ExternalFieldReader(
+    Realm &realm,
+    const bool interpolateInTime,
+    const bool prefetch,
+    const double periodicTime,
+    const double startTime);
+  ~ExternalFieldReader();
+
+  void add_field(
+    stk::mesh::FieldBase *field,
+    const std::string &databaseName);
+
+  // database times and node map; call once the mesh has been populated
+  void initialize();
+
+  // populate the fields at currentTime; returns the database time used
+  double read_fields(const double currentTime);
+
+  // false when asked for but MPI does not provide MPI_THREAD_MULTIPLE
+  bool prefetch_enabled() const { return prefetch_; }
+
+  // bracketing database steps and their linear interpolation weights
+  struct TimeBracket {
+    int stepLo_;
+    int stepHi_;
+    double wLo_;
+    double wHi_;
+    double time_;
+  };
+
+  static TimeBracket bracket(
+    const std::vector<double> &databaseTimes,
+    const double currentTime,
+    const bool interpolateInTime,
+    const double periodicTime,
+    const double startTime);
+
+private:
+  struct Snapshot {
+    int step_;
+    // per field, database node order, interleaved components
+    std::vector<std::vector<double> > values_;
+  };
+
+  std::shared_ptr<Snapshot> read_snapshot(const int step);
+  std::shared_ptr<Snapshot> fetch(const int step);
+  void prefetch(const int step);
+  void retain(const int stepA, const int stepB, const int stepC);
+
+  Realm &realm_;
+  const bool interpolateInTime_;
+  bool prefetch_;
+  const double periodicTime_;
+  const double startTime_;
+
+  std::vector<stk::mesh::FieldBase *> fields_;
+  std::vector<std::string> databaseNames_;
+  std::vector<bool> fieldOnDatabase_;
+
+  std::vector<double> databaseTimes_;
+  std::vector<stk::mesh::Entity> nodes_;
+
+  // bracketing snapshots plus the one being streamed in
+  std::deque<std::shared_ptr<Snapshot> > ring_;
+  std::future<std::shared_ptr<Snapshot> > pending_;
+  int pendingStep_;
+
+  // serializes access to the input Ioss region
+  std::mutex ioMutex_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -9,6 +9,9 @@
 #define FieldFunctions_h
 
 #include <stk_mesh/base/MetaData.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <vector>
 
 namespace stk{
 namespace mesh{
@@ -40,8 +43,33 @@ namespace nalu{
     &stk::mesh::selectField(*myField);
 
    The above selector would exclude aura-entities
+
+   All loops are threaded over buckets (see parallel_bucket_loop in
+   BucketLoop.h); fused variants exist for the update/clip and multi-field
+   copy patterns that the equation systems call every nonlinear iteration.
 */
 
+// clip counts and extrema of a clipped update on this rank
+struct FieldClipStatistics
+{
+  size_t numClip_[2] = {0, 0}; // below the low bound, above the high bound
+  double min_ = +1.0e16;       // smallest value clipped to the low bound
+  double max_ = -1.0e16;       // largest value clipped to the high bound
+
+  void join(const FieldClipStatistics & other)
+  {
+    numClip_[0] += other.numClip_[0];
+    numClip_[1] += other.numClip_[1];
+    min_ = (other.min_ < min_) ? other.min_ : min_;
+    max_ = (other.max_ > max_) ? other.max_ : max_;
+  }
+};
+
+// global clip statistics in one collective
+void all_reduce_clip_statistics(
+  stk::ParallelMachine comm,
+  FieldClipStatistics & stats);
+
 // y = alpha*x + beta*y
 void field_axpby(
   const stk::mesh::MetaData & metaData,
@@ -53,6 +81,19 @@ void field_axpby(
   const bool auraIsActive,
   const stk::topology::rank_t entityRankValue=stk::topology::NODE_RANK);
 
+// y = alpha*x + beta*y, clipped to [lowBound, highBound]
+FieldClipStatistics field_axpby_clip(
+  const stk::mesh::MetaData & metaData,
+  const stk::mesh::BulkData & bulkData,
+  const double alpha,
+  const stk::mesh::FieldBase & xField,
+  const double beta,
+  const stk::mesh::FieldBase & yField,
+  const double lowBound,
+  const double highBound,
+  const bool auraIsActive,
+  const stk::topology::rank_t entityRankValue=stk::topology::NODE_RANK);
+
 // x = alpha
 void field_fill(
   const stk::mesh::MetaData & metaData,
@@ -80,6 +121,15 @@ void field_copy(
   const bool auraIsActive,
   const stk::topology::rank_t entityRankValue=stk::topology::NODE_RANK);
 
+// y[f] = x[f] for every pair of fields, in one pass over the buckets
+void field_copy(
+  const stk::mesh::MetaData & metaData,
+  const stk::mesh::BulkData & bulkData,
+  const std::vector<const stk::mesh::FieldBase *> & xFields,
+  const std::vector<const stk::mesh::FieldBase *> & yFields,
+  const bool auraIsActive,
+  const stk::topology::rank_t entityRankValue=stk::topology::NODE_RANK);
+
 // y[compJ] = x[compK]
 void field_index_copy(
   const stk::mesh::MetaData & metaData,
@@ -0,0 +1,102 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef FieldUpdateTracker_h
+#define FieldUpdateTracker_h
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** Modification counters for fields of a realm
+ *
+ * Every recorded write advances a realm-wide clock and stamps the field with
+ * it. Writers that are not tracked individually, e.g., property evaluators
+ * with arbitrary outputs, call mark_all_modified(), which stamps every field
+ * at once. State rotation stamps all multi-state fields.
+ */
+class FieldUpdateTracker
+{
+public:
+  FieldUpdateTracker() {}
+  ~FieldUpdateTracker() {}
+
+  void mark_modified(const stk::mesh::FieldBase &field);
+
+  void mark_all_modified() { allModified_ = ++clock_; }
+
+  // update_field_data_states moves data between the states of a field
+  void mark_states_rotated(const stk::mesh::MetaData &meta);
+
+  size_t last_modified(const stk::mesh::FieldBase &field) const;
+
+  size_t now() const { return clock_; }
+
+  // accounting of executions found to be up to date
+  void record_skip(const double timeSaved);
+  void report_step();
+
+  size_t clock_{0};
+  size_t allModified_{0};
+  std::vector<size_t> fieldStamp_;
+
+  int numSkipped_{0};
+  int numSkippedStep_{0};
+  double timeSaved_{0.0};
+  double timeSavedStep_{0.0};
+};
+
+/** Inputs and outputs of a recomputation, e.g., an AlgorithmDriver
+ *
+ * A tracked recomputation is up to date when it has executed before and
+ * none of its inputs, nor its outputs, were written since; mesh
+ * modification always makes it stale. Outputs are stamped on every
+ * execution, tracked or not, so that downstream dependencies see the write.
+ */
+class FieldDependencies
+{
+public:
+  FieldDependencies() {}
+  ~FieldDependencies() {}
+
+  void add_input(const stk::mesh::FieldBase *field);
+  void add_output(const stk::mesh::FieldBase *field);
+
+  // track a recomputation without inputs, e.g., a constant
+  void set_tracked() { tracked_ = true; }
+
+  bool up_to_date(
+    const FieldUpdateTracker &tracker,
+    const stk::mesh::BulkData &bulk) const;
+
+  void executed(
+    FieldUpdateTracker &tracker,
+    const stk::mesh::BulkData &bulk,
+    const double elapsedTime);
+
+  void skipped(FieldUpdateTracker &tracker) const { tracker.record_skip(lastElapsedTime_); }
+
+  bool tracked_{false};
+  std::vector<const stk::mesh::FieldBase *> inputs_;
+  std::vector<const stk::mesh::FieldBase *> outputs_;
+
+  bool hasExecuted_{false};
+  size_t lastExecution_{0};
+  size_t lastSyncCount_{0};
+  double lastElapsedTime_{0.0};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
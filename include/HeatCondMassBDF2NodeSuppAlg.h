@@ -35,6 +35,8 @@ public:
     double *rhs,
     stk::mesh::Entity node);
 
+  virtual bool is_thread_safe() const { return true; }
+
   ScalarFieldType *temperatureNm1_;
   ScalarFieldType *temperatureN_;
   ScalarFieldType *temperatureNp1_;
@@ -26,6 +26,7 @@ namespace sierra{
 namespace nalu{
 
 class Realms;
+class ExternalFieldReader;
 
 class InputOutputInfo {
 
@@ -62,6 +63,8 @@ public:
   void evaluate_properties() {}
   void initial_work() {}
   double compute_adaptive_time_step() { return 1.0e8; }
+  bool accept_time_step() { return true; }
+  void commit_time_step(const bool /*accepted*/) {}
   void swap_states() {}
   void predict_state() {}   
   void pre_timestep_work() {}  
@@ -75,6 +78,9 @@ public:
 
   // hold the field information
   std::vector<InputOutputInfo *> inputOutputFieldInfo_;
+
+  // streaming reader for external fields; NULL when prefetch is not requested
+  ExternalFieldReader *externalFieldReader_;
 };
 
 } // namespace nalu
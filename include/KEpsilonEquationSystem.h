@@ -27,6 +27,7 @@ class EquationSystems;
 class AlgorithmDriver;
 class TurbKineticEnergyEquationSystem;
 class TurbDissipationEquationSystem;
+class TpetraCoupledLinearSystem;
 
 class KEpsilonEquationSystem : public EquationSystem {
 
@@ -47,6 +48,23 @@ public:
   void initial_work();
   void update_and_clip();
 
+  // k and epsilon as the two dofs of one linear system
+  void assemble_and_solve_coupled();
+  void assemble_coupling_jacobian();
+
+  // off-diagonal entries, lhs[1] and lhs[2], of the 2x2 nodal source
+  // Jacobian; Pk is the clipped, unlimited production
+  static void coupling_jacobian(
+    const double cEpsOne,
+    const double cEpsTwo,
+    const double tkeProdLimitRatio,
+    const double rho,
+    const double tke,
+    const double eps,
+    const double Pk,
+    const double dualVolume,
+    double *lhs);
+
   const bool outputClippingDiag_;
 
   TurbKineticEnergyEquationSystem *tkeEqSys_;
@@ -55,7 +73,10 @@ public:
   ScalarFieldType *tke_;
   ScalarFieldType *eps_;
 
-  bool isInit_;     
+  bool isInit_;
+
+  TpetraCoupledLinearSystem *coupledLinsys_;
+  GenericFieldType *coupledDelta_;
 };
 
 } // namespace nalu
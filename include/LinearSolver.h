@@ -37,6 +37,7 @@ typedef Teuchos::ScalarTraits<Scalar> STS;
 
 #include <MueLu_UseShortNames.hpp>    // => typedef MueLu::FooClass<Scalar, LocalOrdinal, ...> Foo
 #include <limits>
+#include <vector>
 
 namespace sierra{
 namespace nalu{
@@ -212,6 +213,10 @@ class TpetraLinearSolver : public LinearSolver
   //! Initialize the MueLU preconditioner before solve
     void setMueLu();
 
+  //! Set up the preconditioner for the current matrix; MueLu honors the
+  //! recompute and reuse options (see setMueLu), Ifpack2 is recomputed
+    void update_preconditioner();
+
   /** Compute the norm of the non-linear solution vector
    *
    *  @param[in] whichNorm [0, 1, 2] norm to be computed
@@ -233,6 +238,21 @@ class TpetraLinearSolver : public LinearSolver
       double & scaledResidual,
       bool isFinalOuterIter);
 
+  /** Solve AX = B for a block of right-hand sides with one preconditioner setup
+   *
+   *  @param[out] sln The solution multivector
+   *  @param[in]  rhs The right-hand side multivector
+   *  @param[out] iterationCount The number of linear solver iterations to convergence
+   *  @param[out] scaledResiduals The final residual norm of each right-hand side
+   *  @param[in]  isFinalOuterIter Is this the final outer iteration
+   */
+    int solve_multiple_rhs(
+      Teuchos::RCP<LinSys::MultiVector> sln,
+      Teuchos::RCP<LinSys::MultiVector> rhs,
+      int & iterationCount,
+      std::vector<double> & scaledResiduals,
+      bool isFinalOuterIter);
+
     virtual PetraType getType() override { return PT_TPETRA; }
 
   private:
@@ -11,6 +11,7 @@
 
 #include <LinearSolverTypes.h>
 #include <KokkosInterface.h>
+#include <SimdInterface.h>
 
 #include <Teuchos_RCP.hpp>
 
@@ -44,11 +45,20 @@ public:
     Realm &realm,
     const unsigned numDof,
     EquationSystem *eqSys,
-    LinearSolver *linearSolver);
+    LinearSolver *linearSolver,
+    const unsigned numSegregatedComponents = 1);
 
   virtual ~LinearSystem() {}
 
-  static LinearSystem *create(Realm& realm, const unsigned numDof, EquationSystem *eqSys, LinearSolver *linearSolver);
+  /** Create the linear system for an equation with numDof dofs per node
+   *
+   *  When segregated is true, the numDof components share a single scalar
+   *  operator (the average of the diagonal component blocks) and are solved as
+   *  a block of right-hand sides; coupling between components is lagged.
+   */
+  static LinearSystem *create(
+    Realm& realm, const unsigned numDof, EquationSystem *eqSys, LinearSolver *linearSolver,
+    const bool segregated = false);
 
   // Graph/Matrix Construction
   virtual void buildNodeGraph(const stk::mesh::PartVector & parts)=0; // for nodal assembly (e.g., lumped mass and source)
@@ -86,8 +96,29 @@ public:
       const char * trace_tag
       )=0;
 
+  /** Sum a single simd lane of the element rhs/lhs into the system
+   *
+   *  Reads lane simdIndex directly from the simd views, avoiding a copy of
+   *  the element matrix into scalar scratch.
+   */
+  virtual void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const DoubleType*> & simdrhs,
+      const SharedMemView<const DoubleType**> & simdlhs,
+      const int simdIndex,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag
+      )=0;
 
 
+  /** Sum the rhs/lhs of an entity list into the system
+   *
+   *  All scratch is owned by the caller (scratchIds is resized to hold the
+   *  column ids and their sort permutation), so concurrent calls with
+   *  distinct scratch are safe.
+   */
   virtual void sumInto(
     const std::vector<stk::mesh::Entity> & sym_meshobj,
     std::vector<int> &scratchIds,
@@ -123,9 +154,25 @@ public:
   virtual int solve(stk::mesh::FieldBase * linearSolutionField)=0;
   virtual void loadComplete()=0;
 
+  /** Multiple right-hand sides sharing one operator and preconditioner
+   *
+   *  The operator is assembled along with the first right-hand side. The
+   *  remaining right-hand sides are assembled with set_rhs_only(true), which
+   *  leaves the matrix untouched, and each one is saved with store_rhs().
+   *  solve_multiple_rhs() then solves all of them in a single block solve and
+   *  writes column k to components [k*numDof, (k+1)*numDof) of the field.
+   */
+  virtual void setup_multiple_rhs(const unsigned numRhs)=0;
+  virtual void store_rhs(const unsigned rhsIndex)=0;
+  virtual int solve_multiple_rhs(stk::mesh::FieldBase * linearSolutionField)=0;
+  void set_rhs_only(const bool rhsOnly) { rhsOnly_ = rhsOnly; }
+  bool rhs_only() const { return rhsOnly_; }
+
   virtual void writeToFile(const char * filename, bool useOwned=true)=0;
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true)=0;
-  unsigned numDof() const { return numDof_; }
+  // dofs per node as assembled by the algorithms and held by the solution field
+  unsigned numDof() const { return numDof_*numSegregatedComponents_; }
+  bool segregated() const { return numSegregatedComponents_ > 1; }
   const int & linearSolveIterations() {return linearSolveIterations_; }
   const double & linearResidual() {return linearResidual_; }
   const double & nonLinearResidual() {return nonLinearResidual_; }
@@ -152,6 +199,7 @@ protected:
   int writeCounter_;
 
   const unsigned numDof_;
+  const unsigned numSegregatedComponents_;
   const std::string eqSysName_;
   LinearSolver * linearSolver_;
   int linearSolveIterations_;
@@ -161,6 +209,7 @@ protected:
   double scaledNonLinearResidual_;
   bool recomputePreconditioner_;
   bool reusePreconditioner_;
+  bool rhsOnly_;
 
 public:
   bool provideOutput_;
@@ -36,6 +36,8 @@ public:
     double *rhs,
     stk::mesh::Entity node);
 
+  virtual bool is_thread_safe() const { return true; }
+
   std::vector<double> params_;
   ScalarFieldType *dualNodalVolume_;
   int nDim_;
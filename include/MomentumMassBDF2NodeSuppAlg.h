@@ -34,6 +34,8 @@ public:
     double *lhs,
     double *rhs,
     stk::mesh::Entity node);
+
+  virtual bool is_thread_safe() const { return true; }
   
   VectorFieldType *velocityNm1_;
   VectorFieldType *velocityN_;
@@ -31,13 +31,16 @@ class NaluEnv
   static NaluEnv &self();
 
   MPI_Comm parallelCommunicator_;
+  MPI_Comm worldCommunicator_;
   int pSize_;
   int pRank_;
+  int worldRank_;
   std::streambuf *stdoutStream_;
   std::ostream *naluLogStream_;
   std::ostream *naluParallelStream_;
   bool parallelLog_;
   std::string baseName_;
+  std::string naluLogName_;
   
   NaluEmptyStreamBuffer naluEmptyStreamBuffer_;
   std::filebuf naluStreamBuffer_;
@@ -49,6 +52,11 @@ class NaluEnv
   MPI_Comm parallel_comm();
   int parallel_size();
   int parallel_rank();
+  MPI_Comm world_comm();
+  int world_rank();
+  void split_parallel_comm(const int color);
+  void free_parallel_comm();
+  static std::string group_log_name(const std::string &naluLogName, const int group);
   void set_log_file_stream(std::string naluLogName, bool pprint = false);
   void close_log_file_stream();
   double nalu_time();
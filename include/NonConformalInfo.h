@@ -90,6 +90,7 @@ class NonConformalInfo {
   void construct_bounding_boxes();
   void determine_elems_to_ghost();
   void complete_search();
+  void complete_interface_operators();
   void provide_diagnosis();
   size_t error_check();
 
@@ -127,6 +128,9 @@ class NonConformalInfo {
   /* vector of DgInfo */
   std::vector<std::vector<DgInfo *> > dgInfoVec_;
 
+  /* DgInfo grouped by (current, opposing) element topology; rebuilt by complete_search */
+  std::vector<std::vector<DgInfo *> > dgInfoTopoGroups_;
+
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
 
@@ -0,0 +1,166 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef PointCloudElementOperator_h
+#define PointCloudElementOperator_h
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Ghosting.hpp>
+#include <stk_mesh/base/Types.hpp>
+#include <stk_search/BoundingBox.hpp>
+#include <stk_search/IdentProc.hpp>
+#include <stk_search/SearchMethod.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+/** Cached search of a point cloud against the elements of a set of parts
+ *
+ * Each locally owned point carries an extent (a sphere of given radius or a
+ * box of given half widths). The operator finds the elements that overlap
+ * the extent, ghosts them to the point owner and, optionally, locates the
+ * element that contains the point centre along with its isoparametric
+ * coordinates.
+ *
+ * The search is cached: a point is searched with its extent inflated by the
+ * size of its last donor element, so that it only needs to be searched again
+ * once it has moved further than that. Points within their inflation are
+ * resolved against their cached candidates, and elements are only ever added
+ * to the ghosting in between full searches. A full search is done when the
+ * ghosting holds more stale elements than live ones or when asked for, e.g.,
+ * when the mesh itself moves.
+ */
+class PointCloudElementOperator
+{
+public:
+  enum PointShape {
+    SPHERE_POINT = 0,
+    BOX_POINT    = 1
+  };
+
+  PointCloudElementOperator(
+    Realm &realm,
+    const std::string &ghostingName,
+    const stk::mesh::PartVector &searchParts,
+    const stk::search::SearchMethod searchMethod,
+    const PointShape pointShape,
+    const bool findBestElement);
+  ~PointCloudElementOperator();
+
+  // register a locally owned point; halfWidth is the radius (sphere) or nDim half widths (box)
+  size_t add_point(
+    const uint64_t id,
+    const double *center,
+    const double *halfWidth);
+
+  // move a point; takes effect at the next update()
+  void set_point_center(
+    const size_t k,
+    const double *center);
+
+  // search, ghost and locate; returns true when any element set or donor changed
+  bool update(
+    const bool forceFullSearch = false);
+
+  size_t num_points() const { return points_.size(); }
+  uint64_t point_id(const size_t k) const { return points_[k].id_; }
+  const double *point_center(const size_t k) const { return &points_[k].center_[0]; }
+
+  // elements overlapping the point extent and their unique nodes
+  const std::vector<stk::mesh::Entity> &elements(const size_t k) const { return points_[k].elems_; }
+  const std::vector<stk::mesh::Entity> &nodes(const size_t k) const { return points_[k].nodes_; }
+
+  // donor element and isoparametric coordinates (findBestElement only)
+  stk::mesh::Entity best_element(const size_t k) const { return points_[k].bestElem_; }
+  const double *iso_par_coords(const size_t k) const { return &points_[k].isoParCoords_[0]; }
+
+  stk::mesh::Ghosting *ghosting() const { return ghosting_; }
+
+private:
+  typedef stk::search::IdentProc<uint64_t,int> theKey;
+  typedef stk::search::Point<double> Point;
+  typedef stk::search::Sphere<double> Sphere;
+  typedef stk::search::Box<double> Box;
+  typedef std::pair<Sphere,theKey> boundingSphere;
+  typedef std::pair<Box,theKey> boundingElementBox;
+
+  struct PointData {
+    uint64_t id_;
+    std::vector<double> center_;
+    std::vector<double> halfWidth_;
+
+    // centre and inflation of the last search; centre of the last locate
+    std::vector<double> searchCenter_;
+    double searchInflation_;
+    std::vector<double> locateCenter_;
+    bool searched_;
+
+    // size of the donor element; inflation of the next search
+    double donorSize_;
+
+    // cached candidates and their bounding boxes (min then max, nDim each)
+    std::vector<stk::mesh::Entity> candidates_;
+    std::vector<double> candidateBoxes_;
+
+    // current product
+    std::vector<stk::mesh::Entity> elems_;
+    std::vector<stk::mesh::Entity> nodes_;
+    stk::mesh::Entity bestElem_;
+    std::vector<double> isoParCoords_;
+  };
+
+  void populate_candidate_elements();
+
+  void search(
+    const std::vector<size_t> &pointIndices,
+    const bool fullSearch);
+
+  void element_box(
+    stk::mesh::Entity elem,
+    double *box) const;
+
+  bool overlaps(
+    const PointData &point,
+    const double *box) const;
+
+  bool locate(PointData &point);
+
+  bool too_many_stale_ghosts() const;
+
+  Realm &realm_;
+  const std::string ghostingName_;
+  const stk::mesh::PartVector searchParts_;
+  const stk::search::SearchMethod searchMethod_;
+  const PointShape pointShape_;
+  const bool findBestElement_;
+  const int nDim_;
+
+  stk::mesh::Ghosting *ghosting_;
+  bool fullSearchPending_;
+
+  std::vector<PointData> points_;
+
+  // locally owned element boxes; the mesh is static in between full searches
+  std::vector<boundingElementBox> boundingElementBoxVec_;
+
+  // scratch space
+  std::vector<double> ws_coordinates_;
+  std::vector<double> ws_isoParCoords_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -41,7 +41,8 @@ public:
     const std::string independentDofName,
     const std::string eqSysName,
     const bool managesSolve = false,
-    const bool isFEM = false);
+    const bool isFEM = false,
+    const int numRhs = 1);
   virtual ~ProjectedNodalGradientEquationSystem();
 
   void set_data_map( 
@@ -88,6 +89,9 @@ public:
   // external intended to be called by another EqSystem (used when someone manages PNGEqs)
   void solve_and_update_external();
 
+  // one operator assembly and a block solve over all numRhs_ components
+  void assemble_and_solve_multiple_rhs();
+
   void initialize();
   void reinitialize_linear_system();
 
@@ -104,6 +108,11 @@ public:
   const bool managesSolve_;
   const bool isFEM_;
 
+  // components of the independent dof, each a right-hand side sharing the
+  // operator; dofName holds the gradient of component k at offset k*nDim
+  const int numRhs_;
+  int rhsComponent_;
+
   // for exach equation, boundary data may be different
   std::map<BoundaryConditionType, std::string> dataMap_;
 
@@ -11,6 +11,7 @@
 
 #include <Enums.h>
 #include <FieldTypeDef.h>
+#include <FieldUpdateTracker.h>
 
 // yaml for parsing..
 #include <yaml-cpp/yaml.h>
@@ -22,6 +23,7 @@
 #include <Teuchos_RCP.hpp>
 #include <overset/OversetManager.h>
 #include <MeshMotionInfo.h>
+#include <TimeStepController.h>
 
 #include <stk_util/util/ParameterList.hpp>
 
@@ -122,6 +124,7 @@ class Realm {
   void initialize_global_variables();
 
   void balance_nodes();
+  void reorder_mesh();
 
   void create_output_mesh();
   void create_restart_mesh();
@@ -139,6 +142,9 @@ class Realm {
   void commit();
 
   void update_six_dof_motion();
+  // six-DOF body state advanced by pre_timestep_work; restored to repeat a rejected step
+  void save_time_step_state();
+  void restore_time_step_state();
   void process_mesh_motion();
   void compute_centroid_on_parts(
     std::vector<std::string> partNames,
@@ -307,7 +313,11 @@ class Realm {
   virtual double populate_restart( double &timeStepNm1, int &timeStepCount);
   virtual void populate_derived_quantities();
   virtual void evaluate_properties();
+  void setup_property_dependencies();
   virtual double compute_adaptive_time_step();
+  virtual bool accept_time_step();
+  virtual void commit_time_step(const bool accepted);
+  double compute_truncation_error();
   virtual void swap_states();
   virtual void predict_state();
   virtual void pre_timestep_work();
@@ -420,6 +430,11 @@ class Realm {
 
   bool realmUsesEdges_;
   int solveFrequency_;
+
+  // optional processor group size; realms on disjoint groups advance concurrently
+  int numberOfProcessors_;
+  bool activeOnThisRank_;
+
   bool isTurbulent_;
   bool needsEnthalpy_;
 
@@ -453,8 +468,10 @@ class Realm {
 
   double maxCourant_;
   double maxReynolds_;
-  double targetCourant_;
-  double timeStepChangeFactor_;
+  double maxDiffusionNumber_;
+  double truncationError_;
+  TimeStepController timeStepController_;
+  std::vector<std::vector<double> > sixDofStateN_;
   int currentNonlinearIteration_;
 
   SolutionOptions *solutionOptions_;
@@ -486,6 +503,7 @@ class Realm {
   double timerTransferExecute_;
   double timerSkinMesh_;
   double timerSortExposedFace_;
+  double timerReorderMesh_;
 
   NonConformalManager *nonConformalManager_;
   OversetManager *oversetManager_;
@@ -553,6 +571,12 @@ class Realm {
   };
   BalanceNodeOptions balanceNodeOptions_;
 
+  // in-partition entity order; none, morton, hilbert or rcm
+  std::string meshReorderingType_;
+
+  // directory of the linear system graph cache; empty for none
+  std::string setupCacheDirectory_;
+
   // beginning wall time
   double wallTimeStart_;
 
@@ -624,6 +648,13 @@ class Realm {
   // min volume
   double minDualVolume_;
 
+  // incremented on each compute_geometry; invalidates cached element geometry
+  size_t geometryUpdateCount_{0};
+
+  // write stamps of fields; lets drivers skip recomputation of unchanged inputs
+  FieldUpdateTracker fieldUpdateTracker_;
+  FieldDependencies propertyDependencies_;
+
   std::string physics_part_name(std::string) const;
   std::vector<std::string> physics_part_names(std::vector<std::string>) const;
   std::string get_quad_type() const;
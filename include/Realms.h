@@ -35,10 +35,16 @@ class Simulation;
 class Realms {
 
 public:
-  Realms(Simulation& sim) : simulation_(sim) {}
+  Realms(Simulation& sim) : simulation_(sim), concurrentRealms_(false) {}
   ~Realms();
 
   void load(const YAML::Node & node) ;
+  int assign_processor_groups(const std::vector<int> &numberOfProcessors);
+  // group (realm index) of worldRank for consecutive assignment; -1 when no realm specifies a count
+  static int processor_group(
+    const std::vector<int> &numberOfProcessors,
+    const int worldSize,
+    const int worldRank);
   void breadboard();
   void initialize();
   Simulation *root();
@@ -64,6 +70,9 @@ public:
 
   Simulation &simulation_;
   RealmVector realmVector_;
+
+  // each realm owns a disjoint processor group and advances concurrently
+  bool concurrentRealms_;
 };
 
 } // namespace nalu
@@ -36,6 +36,8 @@ public:
     double *rhs,
     stk::mesh::Entity node);
 
+  virtual bool is_thread_safe() const { return true; }
+
   ScalarFieldType *scalarQN_;
   ScalarFieldType *scalarQNp1_;
   ScalarFieldType *densityN_;
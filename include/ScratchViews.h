@@ -712,11 +712,21 @@ void fill_pre_req_data(ElemDataRequests& dataNeeded,
                        ScratchViews<double>& prereqData,
                        bool fillMEViews = true);
 
+// gather field data of a single entity directly into lane simdIndex of the simd views
+void fill_pre_req_data(ElemDataRequests& dataNeeded,
+                       const stk::mesh::BulkData& bulkData,
+                       stk::mesh::Entity elem,
+                       ScratchViews<DoubleType>& simdPrereqData,
+                       int simdIndex);
+
 void fill_master_element_views(ElemDataRequests& dataNeeded,
                                const stk::mesh::BulkData& bulkData,
                                ScratchViews<DoubleType>& prereqData,
                                int faceOrdinal = 0);
 
+// upper bound on the number of scratch views; used for alignment padding
+int get_num_scratch_views(const ElemDataRequests& dataNeeded);
+
 template<typename T = double>
 int get_num_bytes_pre_req_data(ElemDataRequests& dataNeededBySuppAlgs, int nDim)
 {
@@ -728,10 +738,23 @@ int get_num_bytes_pre_req_data(ElemDataRequests& dataNeededBySuppAlgs, int nDim,
   return sizeof(T) * get_num_scalars_pre_req_data(dataNeededBySuppAlgs, nDim, meInfo);
 }
 
+/** Scratch bytes per thread for element assembly
+ *
+ * The default layout holds simdLen scalar ScratchViews in addition to the
+ * simd views. The lean layout (leanScratch=true) gathers straight into the
+ * simd views and scatters each lane directly from the simd rhs/lhs.
+ */
 inline
 int calculate_shared_mem_bytes_per_thread(int lhsSize, int rhsSize, int scratchIdsSize, int nDim,
-                                      ElemDataRequests& dataNeededByKernels)
+                                      ElemDataRequests& dataNeededByKernels,
+                                      bool leanScratch = false)
 {
+    if (leanScratch) {
+      return (rhsSize + lhsSize)*sizeof(DoubleType) + (2*scratchIdsSize)*sizeof(int)
+        + get_num_bytes_pre_req_data<DoubleType>(dataNeededByKernels, nDim)
+        + get_num_scratch_views(dataNeededByKernels)*sizeof(DoubleType);
+    }
+
     int bytes_per_thread = (rhsSize + lhsSize)*sizeof(double) + (2*scratchIdsSize)*sizeof(int) +
                            get_num_bytes_pre_req_data<double>(dataNeededByKernels, nDim);
     bytes_per_thread *= 2*simdLen;
@@ -742,8 +765,16 @@ inline
 int calculate_shared_mem_bytes_per_thread(int lhsSize, int rhsSize, int scratchIdsSize, int nDim,
                                       sierra::nalu::ElemDataRequests& faceDataNeeded,
                                       sierra::nalu::ElemDataRequests& elemDataNeeded,
-                                      const sierra::nalu::ScratchMeInfo &meInfo)
+                                      const sierra::nalu::ScratchMeInfo &meInfo,
+                                      bool leanScratch = false)
 {
+    if (leanScratch) {
+      return (rhsSize + lhsSize)*sizeof(DoubleType) + (2*scratchIdsSize)*sizeof(int)
+        + sierra::nalu::get_num_bytes_pre_req_data<DoubleType>(faceDataNeeded, nDim)
+        + sierra::nalu::get_num_bytes_pre_req_data<DoubleType>(elemDataNeeded, nDim, meInfo)
+        + (get_num_scratch_views(faceDataNeeded) + get_num_scratch_views(elemDataNeeded))*sizeof(DoubleType);
+    }
+
     int bytes_per_thread = (rhsSize + lhsSize)*sizeof(double) + (2*scratchIdsSize)*sizeof(int)
                          + sierra::nalu::get_num_bytes_pre_req_data<double>(faceDataNeeded, nDim)
                          + sierra::nalu::get_num_bytes_pre_req_data<double>(elemDataNeeded, nDim, meInfo);
@@ -0,0 +1,108 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef SetupCache_h
+#define SetupCache_h
+
+#include <LinearSolverTypes.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** 64-bit FNV-1a hash used to validate setup cache entries
+ *
+ * Only the bytes of trivially copyable values are hashed; the result is
+ * not portable across architectures, which is fine for a cache that is
+ * read back by the same executable.
+ */
+class SetupCacheHash
+{
+public:
+  SetupCacheHash() : value_(14695981039346656037ull) {}
+
+  void add(const void *data, const size_t numBytes)
+  {
+    const unsigned char *bytes = static_cast<const unsigned char*>(data);
+    for ( size_t k = 0; k < numBytes; ++k ) {
+      value_ ^= bytes[k];
+      value_ *= 1099511628211ull;
+    }
+  }
+
+  template<typename T>
+  void add(const T &value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "SetupCacheHash: value is not trivially copyable");
+    add(&value, sizeof(T));
+  }
+
+  template<typename T>
+  void add(const std::vector<T> &values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "SetupCacheHash: value is not trivially copyable");
+    add(values.size());
+    add(values.data(), values.size()*sizeof(T));
+  }
+
+  void add(const std::string &value)
+  {
+    add(value.size());
+    add(value.data(), value.size());
+  }
+
+  uint64_t value() const { return value_; }
+
+private:
+  uint64_t value_;
+};
+
+/** Finalized local CRS graph of a TpetraLinearSystem on one rank
+ *
+ * Row lengths and local column indices of the owned and sharedNotOwned
+ * graphs, the column map gids and the owning ranks of the off-rank columns;
+ * enough to skip the connection build and the column communication of
+ * TpetraLinearSystem::finalizeLinearSystem.
+ */
+struct CachedGraph
+{
+  uint64_t key_{0};
+  std::vector<size_t> ownedRowLengths_;
+  std::vector<LinSys::LocalOrdinal> ownedColIndices_;
+  std::vector<size_t> sharedNotOwnedRowLengths_;
+  std::vector<LinSys::LocalOrdinal> sharedNotOwnedColIndices_;
+  std::vector<LinSys::GlobalOrdinal> colGids_;
+  std::vector<int> sourcePids_;
+};
+
+// file of one graph; <directory>/<name>.<numProcs>.<rank>.graph
+std::string cached_graph_file_name(
+  const std::string &directory,
+  const std::string &name,
+  const int numProcs,
+  const int rank);
+
+// false when the file is missing, unreadable or holds another key
+bool read_cached_graph(
+  const std::string &fileName,
+  const uint64_t key,
+  CachedGraph &graph);
+
+// false when the file could not be written
+bool write_cached_graph(
+  const std::string &fileName,
+  const CachedGraph &graph);
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -25,16 +25,23 @@ struct SharedMemData {
          const stk::mesh::BulkData& bulk,
          const ElemDataRequests& dataNeededByKernels,
          unsigned nodesPerEntity,
-         unsigned rhsSize)
+         unsigned rhsSize,
+         bool leanScratch = false)
      : simdPrereqData(team, bulk, nodesPerEntity, dataNeededByKernels)
     {
-        for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
-          prereqData[simdIndex] = std::unique_ptr<ScratchViews<double> >(new ScratchViews<double>(team, bulk, nodesPerEntity, dataNeededByKernels));
+        // the lean layout gathers straight into simdPrereqData; no per-lane views
+        if (!leanScratch) {
+          for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
+            prereqData[simdIndex] = std::unique_ptr<ScratchViews<double> >(new ScratchViews<double>(team, bulk, nodesPerEntity, dataNeededByKernels));
+          }
         }
         simdrhs = get_shmem_view_1D<DoubleType>(team, rhsSize);
         simdlhs = get_shmem_view_2D<DoubleType>(team, rhsSize, rhsSize);
-        rhs = get_shmem_view_1D<double>(team, rhsSize);
-        lhs = get_shmem_view_2D<double>(team, rhsSize, rhsSize);
+        // lanes are scattered straight from simdrhs/simdlhs; scalar copies are optional
+        if (!leanScratch) {
+          rhs = get_shmem_view_1D<double>(team, rhsSize);
+          lhs = get_shmem_view_2D<double>(team, rhsSize, rhsSize);
+        }
 
         scratchIds = get_int_shmem_view_1D(team, rhsSize);
         sortPermutation = get_int_shmem_view_1D(team, rhsSize);
@@ -42,6 +49,8 @@ struct SharedMemData {
 
     const stk::mesh::Entity* elemNodes[simdLen];
     int numSimdElems;
+    // true when any element of the current simd group lies in the VOF interface band
+    bool inInterfaceBand{true};
     std::unique_ptr<ScratchViews<double>> prereqData[simdLen];
     ScratchViews<DoubleType> simdPrereqData;
     SharedMemView<DoubleType*> simdrhs;
@@ -59,18 +68,25 @@ struct SharedMemData_FaceElem {
          const ElemDataRequests& faceDataNeeded,
          const ElemDataRequests& elemDataNeeded,
          const ScratchMeInfo& meElemInfo,
-         unsigned rhsSize)
+         unsigned rhsSize,
+         bool leanScratch = false)
      : simdFaceViews(team, bulk, meElemInfo.nodesPerFace_, faceDataNeeded),
        simdElemViews(team, bulk, meElemInfo, elemDataNeeded)
     {
-        for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
-          faceViews[simdIndex] = std::unique_ptr<ScratchViews<double> >(new ScratchViews<double>(team, bulk, meElemInfo.nodesPerFace_, faceDataNeeded));
-          elemViews[simdIndex] = std::unique_ptr<ScratchViews<double> >(new ScratchViews<double>(team, bulk, meElemInfo, elemDataNeeded));
+        // the lean layout gathers straight into the simd views; no per-lane views
+        if (!leanScratch) {
+          for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
+            faceViews[simdIndex] = std::unique_ptr<ScratchViews<double> >(new ScratchViews<double>(team, bulk, meElemInfo.nodesPerFace_, faceDataNeeded));
+            elemViews[simdIndex] = std::unique_ptr<ScratchViews<double> >(new ScratchViews<double>(team, bulk, meElemInfo, elemDataNeeded));
+          }
         }
         simdrhs = get_shmem_view_1D<DoubleType>(team, rhsSize);
         simdlhs = get_shmem_view_2D<DoubleType>(team, rhsSize, rhsSize);
-        rhs = get_shmem_view_1D<double>(team, rhsSize);
-        lhs = get_shmem_view_2D<double>(team, rhsSize, rhsSize);
+        // lanes are scattered straight from simdrhs/simdlhs; scalar copies are optional
+        if (!leanScratch) {
+          rhs = get_shmem_view_1D<double>(team, rhsSize);
+          lhs = get_shmem_view_2D<double>(team, rhsSize, rhsSize);
+        }
 
         scratchIds = get_int_shmem_view_1D(team, rhsSize);
         sortPermutation = get_int_shmem_view_1D(team, rhsSize);
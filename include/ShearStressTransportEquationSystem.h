@@ -27,6 +27,7 @@ class EquationSystems;
 class AlgorithmDriver;
 class TurbKineticEnergyEquationSystem;
 class SpecificDissipationRateEquationSystem;
+class TpetraCoupledLinearSystem;
 
 class ShearStressTransportEquationSystem : public EquationSystem {
 
@@ -57,6 +58,22 @@ public:
   void compute_f_one_blending();
   void update_and_clip();
 
+  // k and omega as the two dofs of one linear system
+  void assemble_and_solve_coupled();
+  void assemble_coupling_jacobian();
+
+  // k row, omega column of the nodal source Jacobian; desLength is cDES times
+  // the max length scale with DES, otherwise std::numeric_limits<double>::max()
+  static double coupling_jacobian(
+    const double betaStar,
+    const double tkeProdLimitRatio,
+    const double rho,
+    const double tke,
+    const double sdr,
+    const double Pk,
+    const double desLength,
+    const double dualVolume);
+
   TurbKineticEnergyEquationSystem *tkeEqSys_;
   SpecificDissipationRateEquationSystem *sdrEqSys_;
 
@@ -69,6 +86,12 @@ public:
   bool isInit_;
   AlgorithmDriver *sstMaxLengthScaleAlgDriver_;
 
+  // in-situ wall distance solves that were clipped
+  int wallDistSolvesClipped_;
+
+  TpetraCoupledLinearSystem *coupledLinsys_;
+  GenericFieldType *coupledDelta_;
+
   // saved of mesh parts that are for wall bcs
   std::vector<stk::mesh::Part *> wallBcPart_;
      
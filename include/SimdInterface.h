@@ -54,6 +54,10 @@ int get_length_of_next_simd_group(int index, int length)
   return nextLength;
 }
 
+// scalar value, or a single lane of a simd value
+inline double lane_value(const double& value, const int /* simdIndex */) { return value; }
+inline double lane_value(const DoubleType& value, const int simdIndex) { return stk::simd::get_data(value, simdIndex); }
+
 }  // nalu
 }  // sierra
 
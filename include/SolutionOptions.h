@@ -128,6 +128,7 @@ public:
   double inputVariablesRestorationTime_;
   bool inputVariablesInterpolateInTime_;
   double inputVariablesPeriodicTime_;
+  bool inputVariablesPrefetch_;
   bool consistentMMPngDefault_;
   bool useConsolidatedSolverAlg_;
   bool useConsolidatedBcSolverAlg_;
@@ -145,6 +146,25 @@ public:
   double vofCalpha_;
   double vofDensityPhaseOne_;
   double vofDensityPhaseTwo_;
+
+  // master element data cached per element, e.g., scs_areav, scs_grad_op
+  std::vector<std::string> elemGeometryCacheNames_;
+
+  // restrict interface-only VOF kernels to a narrow band of elements
+  bool vofInterfaceBand_;
+  double vofInterfaceBandTol_;
+
+  // gather element data straight into simd scratch views (no per-lane copies)
+  bool leanScratchMemory_;
+
+  // momentum solved with one scalar operator shared by all velocity components
+  bool segregatedMomentum_;
+
+  // two-equation turbulence models solved as one 2-dof system
+  bool coupledTurbulence_;
+
+  // wall distance computed in-situ; needs a wall_distance solver block
+  bool computeWallDistance_;
   
   // mdot post processing
   double mdotAlgAccumulation_;
@@ -11,6 +11,7 @@
 
 #include <Algorithm.h>
 #include <KokkosInterface.h>
+#include <SimdInterface.h>
 
 #include <stk_mesh/base/Entity.hpp>
 #include <vector>
@@ -54,6 +55,17 @@ protected:
     const SharedMemView<const double**> & lhs,
     const char *trace_tag);
 
+  // scatter lane simdIndex of the simd rhs/lhs without extracting it first
+  void apply_coeff(
+    unsigned numMeshobjs,
+    const stk::mesh::Entity* symMeshobjs,
+    const SharedMemView<int*> & scratchIds,
+    const SharedMemView<int*> & sortPermutation,
+    const SharedMemView<const DoubleType*> & simdrhs,
+    const SharedMemView<const DoubleType**> & simdlhs,
+    const int simdIndex,
+    const char *trace_tag);
+
   EquationSystem *eqSystem_;
 };
 
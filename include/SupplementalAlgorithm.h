@@ -44,6 +44,10 @@ public:
     double *rhs,
     stk::mesh::Entity node) {}
   
+  // node_execute may be called concurrently for different nodes; only
+  // algorithms that write nothing but lhs/rhs may return true
+  virtual bool is_thread_safe() const { return false; }
+
   virtual void elem_resize(
     MasterElement *meSCS,
     MasterElement *meSCV) {}
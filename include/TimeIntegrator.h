@@ -41,6 +41,7 @@ public:
 
   void integrate_realm();
   void provide_mean_norm();
+  void synchronize_processor_groups(int &anyRestarted);
   bool simulation_proceeds();
   Simulation* sim_{nullptr};
 
@@ -58,6 +59,7 @@ public:
   bool adaptiveTimeStep_;
   bool terminateBasedOnTime_;
   int nonlinearIterations_;
+  bool concurrentRealms_;
 
   std::string name_;
 
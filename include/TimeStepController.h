@@ -0,0 +1,112 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TimeStepController_h
+#define TimeStepController_h
+
+// yaml for parsing..
+#include <yaml-cpp/yaml.h>
+
+#include <iosfwd>
+#include <string>
+
+namespace sierra{
+namespace nalu{
+
+/** Adaptive time step selection of a realm
+ *
+ * Every active criterion (Courant number, diffusion number and the
+ * estimated local truncation error) is turned into a ratio that scales
+ * linearly with dt and equals one at its target; the largest ratio drives
+ * a PID controller on log(dt).  The default gains (kP, kI, kD) = (0, 1, 0)
+ * reproduce the original dt*targetCourant/maxCourant rescaling.
+ *
+ * Steps whose ratio exceeds rejectionRatio_ may be repeated with a smaller
+ * dt; see accept_time_step and commit_time_step.
+ */
+class TimeStepController
+{
+public:
+  TimeStepController();
+
+  void load(const YAML::Node & node);
+
+  // the largest dt-linear ratio of the active criteria; zero when none is active
+  double error_ratio(
+    const double courant,
+    const double diffusionNumber,
+    const double truncationError) const;
+
+  // evaluate the step just taken; false when this controller asks to repeat it
+  bool accept_time_step(
+    const double courant,
+    const double diffusionNumber,
+    const double truncationError) const;
+
+  // record the (possibly global) outcome of the step dt; a rejected step is
+  // repeated with the step returned by the following call to next_time_step
+  void commit_time_step(
+    const double dt,
+    const double courant,
+    const double diffusionNumber,
+    const double truncationError,
+    const bool accepted);
+
+  // step to take after dt
+  double next_time_step(
+    const double dt,
+    const double courant,
+    const double diffusionNumber,
+    const double truncationError);
+
+  // truncation error estimates need the previous step of the same run
+  bool can_estimate_truncation_error() const { return numAccepted_ > 0; }
+
+  void dump_statistics(std::ostream & os) const;
+
+  // targets; a target of zero deactivates the criterion
+  double targetCourant_;
+  double targetDiffusionNumber_;
+  double truncationErrorTolerance_;
+  double truncationErrorAbsoluteTolerance_;
+  std::string truncationErrorFieldName_;
+
+  // limits and controller gains
+  double timeStepChangeFactor_;
+  double kP_;
+  double kI_;
+  double kD_;
+  bool predictCourant_;
+
+  // rejection; a ratio of zero never rejects
+  double rejectionRatio_;
+  double rejectionSafetyFactor_;
+  int maxRejections_;
+
+  // last two accepted ratios and Courant rates (Courant/dt) for the PID terms
+  double ratioNm1_;
+  double ratioNm2_;
+  double courantRateNm1_;
+
+  // a rejected step leaves its retry dt here
+  bool repeatStep_;
+  double repeatTimeStep_;
+  int numConsecutiveRejections_;
+
+  // statistics
+  int numAccepted_;
+  int numRejected_;
+  double minTimeStep_;
+  double maxTimeStep_;
+  double sumTimeStep_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,189 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TpetraCoupledLinearSystem_h
+#define TpetraCoupledLinearSystem_h
+
+#include <TpetraLinearSystem.h>
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+class CoupledComponentLinearSystem;
+
+/** Several scalar equation systems solved as one multi-dof linear system
+ *
+ * Each coupled equation system keeps its algorithms, but its linsys_ is
+ * replaced by a CoupledComponentLinearSystem that assembles into component c
+ * of this system: the (c,c) block of the element matrices and dof c of the
+ * rhs. The owner of the coupled system adds the cross-component blocks,
+ * e.g., source term Jacobians, with the regular numComponents-dof sumInto.
+ * The graph is the union of the component graphs and is finalized once all
+ * components have finalized; one preconditioner and one solve serve all of
+ * the components.
+ */
+class TpetraCoupledLinearSystem : public TpetraLinearSystem
+{
+public:
+  TpetraCoupledLinearSystem(
+    Realm &realm,
+    const unsigned numComponents,
+    EquationSystem *eqSys,
+    LinearSolver * linearSolver);
+  ~TpetraCoupledLinearSystem() {}
+
+  // replace the linear system of eqSys by a view of component c
+  void couple(
+    const unsigned component,
+    EquationSystem *eqSys);
+
+  // called by the component views; the last one finalizes the graph
+  void finalize_component();
+
+  template<typename ValueType>
+  void sum_into_component(
+    const unsigned component,
+    const int numEntities,
+    const stk::mesh::Entity* entities,
+    const ValueType* rhs,
+    const ValueType* lhs,
+    const int simdIndex,
+    int* localIds,
+    int* sortPermutation);
+
+  void apply_dirichlet_component(
+    const unsigned component,
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts);
+
+  /** Solve and scatter component c of the solution to componentDelta[c]
+   *
+   * coupledDelta holds numComponents dofs per node. Each component view is
+   * updated with the iterations of the coupled solve and the nonlinear
+   * residual of its own rows.
+   */
+  int solve_coupled(
+    stk::mesh::FieldBase * coupledDelta,
+    const std::vector<stk::mesh::FieldBase *> &componentDelta);
+
+private:
+  double component_norm2(const unsigned component) const;
+
+  const unsigned numComponents_;
+  unsigned numFinalized_;
+  std::vector<CoupledComponentLinearSystem *> componentLinsys_;
+};
+
+/** The linear system of one equation of a TpetraCoupledLinearSystem
+ *
+ * Graph construction, assembly and row operations act on the component rows
+ * of the coupled system; zeroing, loadComplete and solve belong to the owner
+ * of the coupled system.
+ */
+class CoupledComponentLinearSystem : public LinearSystem
+{
+public:
+  CoupledComponentLinearSystem(
+    Realm &realm,
+    EquationSystem *eqSys,
+    LinearSolver * linearSolver,
+    TpetraCoupledLinearSystem &coupledLinsys,
+    const unsigned component);
+  ~CoupledComponentLinearSystem() {}
+
+  // Graph/Matrix Construction
+  void buildNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildEdgeToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildReducedElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildFaceElemToNodeGraph(const stk::mesh::PartVector & parts);
+  void buildNonConformalNodeGraph(const stk::mesh::PartVector & parts);
+  void buildOversetNodeGraph(const stk::mesh::PartVector & parts);
+  void finalizeLinearSystem();
+
+  // Matrix Assembly
+  void zeroSystem();
+
+  void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const double*> & rhs,
+      const SharedMemView<const double**> & lhs,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag);
+
+  void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const DoubleType*> & simdrhs,
+      const SharedMemView<const DoubleType**> & simdlhs,
+      const int simdIndex,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag);
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & entities,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  void prepareConstraints(
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  void resetRows(
+    std::vector<stk::mesh::Entity> nodeList,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  // Solve
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete();
+
+  void setup_multiple_rhs(const unsigned numRhs);
+  void store_rhs(const unsigned rhsIndex);
+  int solve_multiple_rhs(stk::mesh::FieldBase * linearSolutionField);
+
+  void writeToFile(const char * filename, bool useOwned=true);
+  void writeSolutionToFile(const char * filename, bool useOwned=true);
+
+  // statistics of the coupled solve for this component
+  void set_solve_statistics(
+    const int linearSolveIterations,
+    const double linearResidual,
+    const double nonLinearResidual);
+
+protected:
+  void beginLinearSystemConstruction() {}
+  void checkError(const int /* err_code */, const char * /* msg */) {}
+
+private:
+  TpetraCoupledLinearSystem &coupledLinsys_;
+  const unsigned component_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -12,6 +12,7 @@
 #include <LinearSystem.h>
 
 #include <KokkosInterface.h>
+#include <SetupCache.h>
 
 #include <Tpetra_Vector.hpp>
 #include <Tpetra_CrsMatrix.hpp>
@@ -23,6 +24,7 @@
 #include <vector>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace stk {
 class CommNeighbors;
@@ -61,7 +63,8 @@ public:
     Realm &realm,
     const unsigned numDof,
     EquationSystem *eqSys,
-    LinearSolver * linearSolver);
+    LinearSolver * linearSolver,
+    const unsigned numSegregatedComponents = 1);
   ~TpetraLinearSystem();
 
    // Graph/Matrix Construction
@@ -88,6 +91,16 @@ public:
       const SharedMemView<int*> & sortPermutation,
       const char * trace_tag);
 
+  void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const DoubleType*> & simdrhs,
+      const SharedMemView<const DoubleType**> & simdlhs,
+      const int simdIndex,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag);
+
   void sumInto(
     const std::vector<stk::mesh::Entity> & entities,
     std::vector<int> &scratchIds,
@@ -122,6 +135,11 @@ public:
   // Solve
   int solve(stk::mesh::FieldBase * linearSolutionField);
   void loadComplete();
+
+  // multiple right-hand sides
+  void setup_multiple_rhs(const unsigned numRhs);
+  void store_rhs(const unsigned rhsIndex);
+  int solve_multiple_rhs(stk::mesh::FieldBase * linearSolutionField);
   void writeToFile(const char * filename, bool useOwned=true);
   void printInfo(bool useOwned=true);
   void writeSolutionToFile(const char * filename, bool useOwned=true);
@@ -135,13 +153,38 @@ public:
 
   Teuchos::RCP<LinSys::Graph>  getOwnedGraph() { return ownedGraph_; }
   Teuchos::RCP<LinSys::Matrix> getOwnedMatrix() { return ownedMatrix_; }
+  Teuchos::RCP<LinSys::Vector> getOwnedRhs() { return ownedRhs_; }
+  Teuchos::RCP<LinSys::MultiVector> getOwnedMultiRhs() { return multiRhs_; }
 
-private:
+protected:
   void buildConnectedNodeGraph(stk::mesh::EntityRank rank,
                                const stk::mesh::PartVector& parts);
 
   void beginLinearSystemConstruction();
 
+  /** Setup cache of the finalized graph
+   *
+   * With a realm setup_cache directory the mesh-based graph builds are only
+   * hashed when called and replayed in finalizeLinearSystem when no valid
+   * cache file exists on every rank. Search-based graphs (nonconformal and
+   * overset) replay the pending builds and turn the cache off.
+   */
+  enum GraphBuildType {
+    GRAPH_NODE = 0,
+    GRAPH_FACE = 1,
+    GRAPH_EDGE = 2,
+    GRAPH_ELEM = 3,
+    GRAPH_REDUCED_ELEM = 4,
+    GRAPH_FACE_ELEM = 5
+  };
+
+  bool defer_graph_build(
+    const GraphBuildType type,
+    const stk::mesh::PartVector &parts);
+  void disable_graph_cache();
+  void replay_graph_builds();
+  uint64_t graph_cache_key();
+
   void checkError( const int err_code, const char * msg) {}
 
   void compute_send_lengths(const std::vector<stk::mesh::Entity>& rowEntities,
@@ -163,10 +206,34 @@ private:
   void fill_entity_to_row_LID_mapping();
   void fill_entity_to_col_LID_mapping();
 
+  // Dirichlet rows [rowOffset+beginPos, rowOffset+endPos) of each node; the
+  // solution field holds fieldDof components
+  void apply_dirichlet_rows(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos,
+    const unsigned rowOffset,
+    const unsigned fieldDof);
+
+  // matrix fillComplete and export; skipped for rhs-only assembly
+  void load_complete_matrix();
+
+  // block solve of multiRhs_; norms are summed over the columns or combined as one 2-norm
+  int solve_block(
+    stk::mesh::FieldBase * linearSolutionField,
+    const bool sumNorms);
+
   void copy_tpetra_to_stk(
     const Teuchos::RCP<LinSys::Vector> tpetraVector,
     stk::mesh::FieldBase * stkField);
 
+  // column k of the multivector is copied to components [k*numDof_, (k+1)*numDof_)
+  void copy_tpetra_to_stk(
+    const Teuchos::RCP<LinSys::MultiVector> tpetraVector,
+    stk::mesh::FieldBase * stkField);
+
   // This method copies a stk::mesh::field to a tpetra multivector. Each dof/node is written into a different
   // vector in the multivector.
   void copy_stk_to_tpetra(stk::mesh::FieldBase * stkField,
@@ -209,6 +276,8 @@ private:
 
   Teuchos::RCP<LinSys::Vector> sln_;
   Teuchos::RCP<LinSys::Vector> globalSln_;
+  Teuchos::RCP<LinSys::MultiVector> multiRhs_;
+  Teuchos::RCP<LinSys::MultiVector> multiSln_;
   Teuchos::RCP<LinSys::Export> exporter_;
 
   MyLIDMapType myLIDs_;
@@ -217,7 +286,10 @@ private:
   LocalOrdinal maxOwnedRowId_; // = num_owned_nodes * numDof_
   LocalOrdinal maxSharedNotOwnedRowId_; // = (num_owned_nodes + num_sharedNotOwned_nodes) * numDof_
 
-  std::vector<int> sortPermutation_;
+  bool useGraphCache_;
+  bool replayingGraphBuilds_;
+  SetupCacheHash graphBuildHash_;
+  std::vector<std::pair<GraphBuildType, stk::mesh::PartVector> > deferredGraphBuilds_;
 };
 
 int getDofStatus_impl(stk::mesh::Entity node, const Realm& realm);
@@ -0,0 +1,123 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef TpetraSegregatedLinearSystem_h
+#define TpetraSegregatedLinearSystem_h
+
+#include <TpetraLinearSystem.h>
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Segregated form of a multi-component (e.g., momentum) linear system
+ *
+ * Algorithms assemble the usual numComponents-blocked element contributions.
+ * Only a scalar operator is stored: the average of the diagonal component
+ * blocks. Each component of the rhs is a column of a multivector and all
+ * components are solved in a single block solve. Off-diagonal (cross
+ * component) blocks are dropped from the operator; since the rhs is the full
+ * residual, their effect is lagged to the next nonlinear iteration.
+ */
+class TpetraSegregatedLinearSystem : public TpetraLinearSystem
+{
+public:
+  TpetraSegregatedLinearSystem(
+    Realm &realm,
+    const unsigned numComponents,
+    EquationSystem *eqSys,
+    LinearSolver * linearSolver);
+  ~TpetraSegregatedLinearSystem() {}
+
+  void finalizeLinearSystem();
+
+  // Matrix Assembly
+  void zeroSystem();
+
+  void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const double*> & rhs,
+      const SharedMemView<const double**> & lhs,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag);
+
+  void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const SharedMemView<const DoubleType*> & simdrhs,
+      const SharedMemView<const DoubleType**> & simdlhs,
+      const int simdIndex,
+      const SharedMemView<int*> & localIds,
+      const SharedMemView<int*> & sortPermutation,
+      const char * trace_tag);
+
+  void sumInto(
+    const std::vector<stk::mesh::Entity> & entities,
+    std::vector<int> &scratchIds,
+    std::vector<double> &scratchVals,
+    const std::vector<double> & rhs,
+    const std::vector<double> & lhs,
+    const char *trace_tag=0
+    );
+
+  void applyDirichletBCs(
+    stk::mesh::FieldBase * solutionField,
+    stk::mesh::FieldBase * bcValuesField,
+    const stk::mesh::PartVector & parts,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  void prepareConstraints(
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  void resetRows(
+    const std::vector<stk::mesh::Entity> nodeList,
+    const unsigned beginPos,
+    const unsigned endPos);
+
+  // Solve
+  int solve(stk::mesh::FieldBase * linearSolutionField);
+  void loadComplete();
+
+  // the components already occupy the multiple right-hand sides
+  void setup_multiple_rhs(const unsigned numRhs);
+  void store_rhs(const unsigned rhsIndex);
+  int solve_multiple_rhs(stk::mesh::FieldBase * linearSolutionField);
+
+private:
+  template<typename ValueType>
+  void sum_into_segregated(
+    const int numEntities,
+    const stk::mesh::Entity* entities,
+    const ValueType* rhs,
+    const ValueType* lhs,
+    const int simdIndex,
+    int* localIds,
+    int* sortPermutation);
+
+  // rows are shared by all components; row operations must span every component
+  void check_component_range(
+    const unsigned beginPos,
+    const unsigned endPos,
+    const char * msg) const;
+
+  const unsigned numComponents_;
+
+  Teuchos::RCP<LinSys::MultiVector> sharedNotOwnedMultiRhs_;
+  host_view_type ownedLocalMultiRhs_;
+  host_view_type sharedNotOwnedLocalMultiRhs_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
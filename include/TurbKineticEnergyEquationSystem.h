@@ -26,6 +26,7 @@ class AssembleNodalGradAlgorithmDriver;
 class LinearSystem;
 class EquationSystems;
 class ProjectedNodalGradientEquationSystem;
+class WallDistEquationSystem;
 
 class TurbKineticEnergyEquationSystem : public EquationSystem {
 
@@ -102,6 +103,9 @@ public:
 
   ProjectedNodalGradientEquationSystem *projectedNodalGradEqs_;
 
+  // in-situ minimum_distance_to_wall
+  WallDistEquationSystem *wallDistEqSys_;
+
   bool isInit_;
 
 };
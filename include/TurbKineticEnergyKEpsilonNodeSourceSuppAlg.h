@@ -45,6 +45,8 @@ public:
   const double includeDivU_;
   const double twoThirds_;
   const int nDim_;
+  // destruction is linearized in eps by the coupled k-eps system
+  const bool coupled_;
 };
 
 } // namespace nalu
@@ -92,33 +92,17 @@ public:
   // populate nodal field and output norms (if appropriate)
   void execute();
 
-  // compute tke and stress for each type of operation
-  void compute_tke(
-    const bool isReynolds,
-    const std::string &averageBlockName,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_reynolds_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
-    stk::mesh::Selector s_all_nodes);
-
-  void compute_favre_stress(
-    const std::string &averageBlockName,
-    const double &oldTimeFilter,
-    const double &zeroCurrent,
-    const double &dt,
+  /** Running Reynolds, Favre and resolved averages of one averaging block,
+   *  with the resolved tke and the Reynolds, Favre and resolved stresses
+   *  that were requested, in a single pass over the nodes
+   */
+  void accumulate_node_statistics(
+    const AveragingInfo *avInfo,
+    const double oldTimeFilter,
+    const double zeroCurrent,
+    const double dt,
     stk::mesh::Selector s_all_nodes);
 
-  void compute_resolved_stress(
-      const std::string &averageBlockName,
-      const double &oldTimeFilter,
-      const double &zeroCurrent,
-      const double &dt,
-      stk::mesh::Selector s_all_nodes);
-
   void compute_sfs_stress(
       const std::string &averageBlockName,
       const double &oldTimeFilter,
@@ -46,6 +46,10 @@ public:
   virtual void register_nodal_fields(
     stk::mesh::Part *part);
 
+  virtual void register_element_fields(
+    stk::mesh::Part *part,
+    const stk::topology &theTopo);
+
   void register_interior_algorithm(
     stk::mesh::Part *part);
   
@@ -97,6 +101,7 @@ public:
   void smooth_vof_execute();
   void compute_interface_normal();
   void compute_interface_curvature();
+  void compute_interface_band();
 
   void wetted_wall_init();
 
@@ -111,6 +116,8 @@ public:
   VectorFieldType *dvofdx_;
   ScalarFieldType *vofTmp_;
   ScalarFieldType *viscosity_;
+  ScalarFieldType *interfaceBand_;
+  ScalarFieldType *interfaceBandNode_;
 
   AssembleNodalGradAlgorithmDriver *assembleNodalGradAlgDriver_;
   
@@ -0,0 +1,125 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef WallDistEquationSystem_h
+#define WallDistEquationSystem_h
+
+#include <EquationSystem.h>
+#include <FieldTypeDef.h>
+#include <NaluParsing.h>
+
+#include <stk_mesh/base/Part.hpp>
+
+#include <vector>
+
+namespace stk{
+struct topology;
+}
+
+namespace sierra{
+namespace nalu{
+
+class AssembleNodalGradAlgorithmDriver;
+class EquationSystems;
+
+/** Wall distance from a Poisson equation
+ *
+ * lap(phi) = -1 with phi = 0 on all walls and zero flux elsewhere; the
+ * distance follows as d = sqrt(|grad phi|^2 + 2 phi) - |grad phi| and is
+ * written to minimum_distance_to_wall. The solve is done once in
+ * initial_work and, under mesh motion, in pre_timestep_work. Blocks of each
+ * mesh motion form a rigid group (the remaining blocks are a static group);
+ * a group is only re-solved when a group that carries walls moved relative
+ * to it, otherwise its phi rows are held at the previous solution.
+ */
+class WallDistEquationSystem : public EquationSystem {
+
+public:
+  WallDistEquationSystem(
+    EquationSystems& equationSystems);
+  virtual ~WallDistEquationSystem();
+
+  void register_nodal_fields(
+    stk::mesh::Part *part);
+
+  void register_interior_algorithm(
+    stk::mesh::Part *part);
+
+  void register_inflow_bc(
+    stk::mesh::Part *part,
+    const stk::topology &theTopo,
+    const InflowBoundaryConditionData &inflowBCData);
+
+  void register_open_bc(
+    stk::mesh::Part *part,
+    const stk::topology &theTopo,
+    const OpenBoundaryConditionData &openBCData);
+
+  void register_wall_bc(
+    stk::mesh::Part *part,
+    const stk::topology &theTopo,
+    const WallBoundaryConditionData &wallBCData);
+
+  void register_symmetry_bc(
+    stk::mesh::Part *part,
+    const stk::topology &theTopo,
+    const SymmetryBoundaryConditionData &symmetryBCData);
+
+  void register_non_conformal_bc(
+    stk::mesh::Part *part,
+    const stk::topology &theTopo);
+
+  void initialize();
+  void reinitialize_linear_system();
+
+  void initial_work();
+  void pre_timestep_work();
+
+  // the distance is not part of the nonlinear iteration
+  void solve_and_update() {}
+
+  void compute_wall_distance(
+    const stk::mesh::PartVector &frozenParts);
+
+  void register_boundary_nodal_grad(
+    stk::mesh::Part *part,
+    const AlgorithmType algType);
+
+  void setup_motion_groups();
+  std::vector<int> motion_group_moved();
+  static std::vector<int> stale_motion_groups(
+    const std::vector<int> &moved,
+    const std::vector<int> &hasWalls);
+  void store_motion_coordinates();
+
+  ScalarFieldType *wallDistPhi_;
+  VectorFieldType *dphidx_;
+  ScalarFieldType *phiTmp_;
+  ScalarFieldType *diffCoeff_;
+  ScalarFieldType *phiBc_;
+  ScalarFieldType *minDistanceToWall_;
+  VectorFieldType *motionCoordinates_;
+
+  AssembleNodalGradAlgorithmDriver *assembleNodalGradAlgDriver_;
+
+  // number of distance computations; consumers that post-process the
+  // distance compare against it
+  int numSolves_;
+
+  stk::mesh::PartVector interiorPartVec_;
+  stk::mesh::PartVector wallPartVec_;
+
+  // rigid motion groups; the last one holds the blocks without motion
+  std::vector<stk::mesh::PartVector> motionGroupParts_;
+  std::vector<int> motionGroupHasWalls_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,46 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef WallDistSrcNodeSuppAlg_h
+#define WallDistSrcNodeSuppAlg_h
+
+#include <SupplementalAlgorithm.h>
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/Entity.hpp>
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+class WallDistSrcNodeSuppAlg : public SupplementalAlgorithm
+{
+public:
+
+  WallDistSrcNodeSuppAlg(
+    Realm &realm);
+
+  virtual ~WallDistSrcNodeSuppAlg() {}
+
+  virtual void setup();
+
+  virtual void node_execute(
+    double *lhs,
+    double *rhs,
+    stk::mesh::Entity node);
+
+  virtual bool is_thread_safe() const { return true; }
+
+  ScalarFieldType *dualNodalVolume_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -0,0 +1,45 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef WallFrictionVelocityNewton_h
+#define WallFrictionVelocityNewton_h
+
+#include <cstddef>
+
+namespace sierra{
+namespace nalu{
+
+namespace WallFrictionVelocityNewton
+{
+  /** Newton solve of the log law, kappa*up = utau*log(elog*rho*yp*utau/mu),
+   *  for a batch of boundary integration points
+   *
+   * Points are processed simdLen at a time; each lane stops updating once
+   * its own increment drops below the tolerance and a group exits once all
+   * of its lanes have converged. On entry utau holds the initial guess. The
+   * optional converged array receives 1/0 per point. Returns the number of
+   * points that did not converge.
+   */
+  size_t solve_log_law(
+    const size_t numPoints,
+    const double *up,
+    const double *yp,
+    const double *density,
+    const double *viscosity,
+    const double elog,
+    const double kappa,
+    const int maxIteration,
+    const double tolerance,
+    double *utau,
+    int *converged = nullptr);
+}
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -62,6 +62,9 @@ private:
   const double includeDivU_;
   const double twoThirds_;
 
+  // destruction is linearized in eps by the coupled k-eps system
+  const bool coupled_;
+
   // Integration point to node mapping
   const int* ipNodeMap_;
   
@@ -10,6 +10,7 @@
 
 #include <master_element/MasterElement.h>
 #include <master_element/MasterElementFunctions.h>
+#include <master_element/SumFactorizedHex.h>
 
 #include <SimdInterface.h>
 #include <Kokkos_Core.hpp>
@@ -179,6 +180,10 @@ protected:
   std::vector<double> expFaceShapeDerivs_;
   std::vector<double> expFaceShapeDerivsShift_;
 
+  // tensor-contraction geometry operations at the (shifted) integration points
+  SumFactorizedHex<2> sumFactorized_;
+  SumFactorizedHex<2> shiftedSumFactorized_;
+
 private:
   void hex27_shape_fcn(
     int npts,
@@ -0,0 +1,326 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+#ifndef SumFactorizedHex_h
+#define SumFactorizedHex_h
+
+#include <master_element/MasterElementFunctions.h>
+#include <master_element/TensorOps.h>
+
+#include <SimdInterface.h>
+
+#include <stk_util/util/ReportHandler.hpp>
+
+#include <array>
+#include <vector>
+
+namespace sierra{
+namespace nalu{
+
+/** Sum-factorized geometry operations for tensor-product (Lagrange) hexahedra
+ *
+ * The integration points of the CVFEM hexahedra are grouped into blocks that
+ * are tensor products of 1D point sets, e.g., the 6x6x6 scv points or the
+ * 6x6x1 points on a constant-u subcontrol surface.  Within a block the
+ * Jacobian is computed one direction at a time from 1D basis tables,
+ * which reduces the cost from O(p^6) to O(p^4) per element.  Reference
+ * gradients are formed on the fly from the same 1D tables rather than read
+ * from the dense nodes x ips x dim table.
+ *
+ * The view value type may be double or DoubleType.
+ */
+template <int p>
+class SumFactorizedHex
+{
+public:
+  static constexpr int nodes1D = p + 1;
+  static constexpr int nodesPerElement = nodes1D * nodes1D * nodes1D;
+
+  // two quadrature points per subcontrol segment, as in the CVFEM hexahedra
+  static constexpr int maxPoints1D = 2 * nodes1D;
+
+  struct PointBlock {
+    std::array<int, 3> numPoints;
+    std::array<std::array<double, maxPoints1D * nodes1D>, 3> interp;
+    std::array<std::array<double, maxPoints1D * nodes1D>, 3> deriv;
+
+    // tensor index (ps + ns * (pt + nt * pu)) -> integration point ordinal
+    std::vector<int> ipOrdinal;
+
+    // reference direction that is constant on the block (subcontrol surfaces), -1 otherwise
+    int normalDirection;
+  };
+
+  SumFactorizedHex() = default;
+
+  SumFactorizedHex(
+    const std::vector<int>& tensorNodeMap,
+    const std::vector<double>& nodeLocations)
+    : tensorNodeMap_(tensorNodeMap),
+      nodeLocations_(nodeLocations)
+  {
+    STK_ThrowRequire(static_cast<int>(tensorNodeMap_.size()) == nodesPerElement);
+    STK_ThrowRequire(static_cast<int>(nodeLocations_.size()) == nodes1D);
+  }
+
+  void add_block(
+    const std::vector<double>& sPoints,
+    const std::vector<double>& tPoints,
+    const std::vector<double>& uPoints,
+    const std::vector<int>& ipOrdinal,
+    const int normalDirection = -1)
+  {
+    PointBlock blk;
+    const std::vector<double>* points[3] = { &sPoints, &tPoints, &uPoints };
+    for (int dir = 0; dir < 3; ++dir) {
+      const int numPoints = points[dir]->size();
+      STK_ThrowRequire(numPoints > 0 && numPoints <= maxPoints1D);
+      blk.numPoints[dir] = numPoints;
+      for (int q = 0; q < numPoints; ++q) {
+        lagrange_1d((*points[dir])[q], &blk.interp[dir][q * nodes1D], &blk.deriv[dir][q * nodes1D]);
+      }
+    }
+    STK_ThrowRequire(static_cast<int>(ipOrdinal.size()) == blk.numPoints[0] * blk.numPoints[1] * blk.numPoints[2]);
+    blk.ipOrdinal = ipOrdinal;
+    blk.normalDirection = normalDirection;
+    blocks_.push_back(blk);
+  }
+
+  // 1D Lagrange basis values and derivatives at x
+  void lagrange_1d(const double x, double* values, double* derivs) const
+  {
+    for (int a = 0; a < nodes1D; ++a) {
+      double value = 1.0;
+      double deriv = 0.0;
+      for (int m = 0; m < nodes1D; ++m) {
+        if (m == a) continue;
+        const double inv = 1.0 / (nodeLocations_[a] - nodeLocations_[m]);
+        deriv = deriv * (x - nodeLocations_[m]) * inv + value * inv;
+        value *= (x - nodeLocations_[m]) * inv;
+      }
+      values[a] = value;
+      derivs[a] = deriv;
+    }
+  }
+
+  /** Visit the Jacobian, jac[i][j] = dx_i/dxi_j, at every point of every block
+   *  func(blk, ps, pt, pu, jac)
+   */
+  template <typename CoordViewType, typename Func>
+  void for_each_jacobian(const CoordViewType& coords, Func func) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(CoordViewType::rank == 2, "Coordinate view assumed to be rank 2");
+
+    // coordinates in tensor-product order, X[d][c][b][a]
+    ftype X[3][nodes1D][nodes1D][nodes1D];
+    for (int c = 0; c < nodes1D; ++c) {
+      for (int b = 0; b < nodes1D; ++b) {
+        for (int a = 0; a < nodes1D; ++a) {
+          const int n = tensorNodeMap_[a + nodes1D * (b + nodes1D * c)];
+          for (int d = 0; d < 3; ++d) {
+            X[d][c][b][a] = coords(n, d);
+          }
+        }
+      }
+    }
+
+    for (const PointBlock& blk : blocks_) {
+      const int ns = blk.numPoints[0];
+      const int nt = blk.numPoints[1];
+      const int nu = blk.numPoints[2];
+      const double* Is = blk.interp[0].data(); const double* Ds = blk.deriv[0].data();
+      const double* It = blk.interp[1].data(); const double* Dt = blk.deriv[1].data();
+      const double* Iu = blk.interp[2].data(); const double* Du = blk.deriv[2].data();
+
+      // contract in s
+      ftype A[3][nodes1D][nodes1D][maxPoints1D];
+      ftype As[3][nodes1D][nodes1D][maxPoints1D];
+      for (int d = 0; d < 3; ++d) {
+        for (int c = 0; c < nodes1D; ++c) {
+          for (int b = 0; b < nodes1D; ++b) {
+            for (int ps = 0; ps < ns; ++ps) {
+              ftype val = 0.0;
+              ftype dval = 0.0;
+              for (int a = 0; a < nodes1D; ++a) {
+                val += Is[ps * nodes1D + a] * X[d][c][b][a];
+                dval += Ds[ps * nodes1D + a] * X[d][c][b][a];
+              }
+              A[d][c][b][ps] = val;
+              As[d][c][b][ps] = dval;
+            }
+          }
+        }
+      }
+
+      // contract in t
+      ftype B[3][nodes1D][maxPoints1D][maxPoints1D];
+      ftype Bs[3][nodes1D][maxPoints1D][maxPoints1D];
+      ftype Bt[3][nodes1D][maxPoints1D][maxPoints1D];
+      for (int d = 0; d < 3; ++d) {
+        for (int c = 0; c < nodes1D; ++c) {
+          for (int pt = 0; pt < nt; ++pt) {
+            for (int ps = 0; ps < ns; ++ps) {
+              ftype val = 0.0;
+              ftype dsval = 0.0;
+              ftype dtval = 0.0;
+              for (int b = 0; b < nodes1D; ++b) {
+                const double it = It[pt * nodes1D + b];
+                val += it * A[d][c][b][ps];
+                dsval += it * As[d][c][b][ps];
+                dtval += Dt[pt * nodes1D + b] * A[d][c][b][ps];
+              }
+              B[d][c][pt][ps] = val;
+              Bs[d][c][pt][ps] = dsval;
+              Bt[d][c][pt][ps] = dtval;
+            }
+          }
+        }
+      }
+
+      // contract in u
+      for (int pu = 0; pu < nu; ++pu) {
+        for (int pt = 0; pt < nt; ++pt) {
+          for (int ps = 0; ps < ns; ++ps) {
+            ftype jac[3][3];
+            for (int d = 0; d < 3; ++d) {
+              jac[d][0] = 0.0;
+              jac[d][1] = 0.0;
+              jac[d][2] = 0.0;
+            }
+            for (int c = 0; c < nodes1D; ++c) {
+              const double iu = Iu[pu * nodes1D + c];
+              const double du = Du[pu * nodes1D + c];
+              for (int d = 0; d < 3; ++d) {
+                jac[d][0] += iu * Bs[d][c][pt][ps];
+                jac[d][1] += iu * Bt[d][c][pt][ps];
+                jac[d][2] += du * B[d][c][pt][ps];
+              }
+            }
+            func(blk, ps, pt, pu, jac);
+          }
+        }
+      }
+    }
+  }
+
+  template <typename CoordViewType, typename OutputViewType, typename DerivViewType>
+  void grad_op(const CoordViewType& coords, OutputViewType& gradop, DerivViewType& deriv) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(std::is_same<ftype, typename OutputViewType::value_type>::value, "Incompatiable value type for views");
+    static_assert(OutputViewType::rank == 3, "Weight view assumed to be rank 3");
+
+    for_each_jacobian(coords, [&](const PointBlock& blk, int ps, int pt, int pu, ftype jac[][3]) {
+      const int ip = blk.ipOrdinal[ps + blk.numPoints[0] * (pt + blk.numPoints[1] * pu)];
+
+      ftype adjJac[3][3];
+      cofactorMatrix(adjJac, jac);
+
+      ftype det = 0.0;
+      for (int i = 0; i < 3; ++i) det += jac[i][0] * adjJac[i][0];
+      STK_ThrowAssertMsg(stk::simd::are_any(det > tiny_positive_value()), "Problem with Jacobian determinant");
+      const ftype inv_detj = ftype(1.0) / det;
+
+      const double* Is = &blk.interp[0][ps * nodes1D]; const double* Ds = &blk.deriv[0][ps * nodes1D];
+      const double* It = &blk.interp[1][pt * nodes1D]; const double* Dt = &blk.deriv[1][pt * nodes1D];
+      const double* Iu = &blk.interp[2][pu * nodes1D]; const double* Du = &blk.deriv[2][pu * nodes1D];
+      for (int c = 0; c < nodes1D; ++c) {
+        for (int b = 0; b < nodes1D; ++b) {
+          for (int a = 0; a < nodes1D; ++a) {
+            const int n = tensorNodeMap_[a + nodes1D * (b + nodes1D * c)];
+            const double refGrad[3] = {
+              Ds[a] * It[b] * Iu[c],
+              Is[a] * Dt[b] * Iu[c],
+              Is[a] * It[b] * Du[c] };
+            for (int i = 0; i < 3; ++i) {
+              deriv(ip, n, i) = refGrad[i];
+              gradop(ip, n, i) = inv_detj * (adjJac[i][0] * refGrad[0] + adjJac[i][1] * refGrad[1] + adjJac[i][2] * refGrad[2]);
+            }
+          }
+        }
+      }
+    });
+  }
+
+  // Jacobian determinant at each integration point (unweighted)
+  template <typename CoordViewType, typename OutputViewType>
+  void determinant(const CoordViewType& coords, OutputViewType& detj) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(OutputViewType::rank == 1, "determinant view assumed to be rank 1");
+
+    for_each_jacobian(coords, [&](const PointBlock& blk, int ps, int pt, int pu, ftype jac[][3]) {
+      const int ip = blk.ipOrdinal[ps + blk.numPoints[0] * (pt + blk.numPoints[1] * pu)];
+      detj(ip) = jac[0][0] * (jac[1][1] * jac[2][2] - jac[2][1] * jac[1][2])
+               + jac[1][0] * (jac[2][1] * jac[0][2] - jac[0][1] * jac[2][2])
+               + jac[2][0] * (jac[0][1] * jac[1][2] - jac[1][1] * jac[0][2]);
+    });
+  }
+
+  // subcontrol surface area vectors, dx/ds1 x dx/ds2, at each integration point (unweighted)
+  template <typename CoordViewType, typename OutputViewType>
+  void area_vectors(const CoordViewType& coords, OutputViewType& areav) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    static_assert(OutputViewType::rank == 2, "areav view assumed to be rank 2");
+
+    for_each_jacobian(coords, [&](const PointBlock& blk, int ps, int pt, int pu, ftype jac[][3]) {
+      const int ip = blk.ipOrdinal[ps + blk.numPoints[0] * (pt + blk.numPoints[1] * pu)];
+      const int dir = blk.normalDirection;
+      STK_ThrowAssert(dir >= 0);
+      const int s1 = (dir == Jacobian::T_DIRECTION) ? Jacobian::S_DIRECTION : Jacobian::T_DIRECTION;
+      const int s2 = (dir == Jacobian::U_DIRECTION) ? Jacobian::S_DIRECTION : Jacobian::U_DIRECTION;
+      areav(ip, 0) = jac[1][s1] * jac[2][s2] - jac[2][s1] * jac[1][s2];
+      areav(ip, 1) = jac[2][s1] * jac[0][s2] - jac[0][s1] * jac[2][s2];
+      areav(ip, 2) = jac[0][s1] * jac[1][s2] - jac[1][s1] * jac[0][s2];
+    });
+  }
+
+  // interpolate a component-major nodal field (field[n + nodesPerElement * comp]) to a point
+  void interpolate_point(
+    const int nComp,
+    const double* isoParCoord,
+    const double* field,
+    double* result) const
+  {
+    double ls[nodes1D]; double lt[nodes1D]; double lu[nodes1D];
+    double dummy[nodes1D];
+    lagrange_1d(isoParCoord[0], ls, dummy);
+    lagrange_1d(isoParCoord[1], lt, dummy);
+    lagrange_1d(isoParCoord[2], lu, dummy);
+
+    for (int comp = 0; comp < nComp; ++comp) {
+      const double* f = field + nodesPerElement * comp;
+      double val = 0.0;
+      for (int c = 0; c < nodes1D; ++c) {
+        double tval = 0.0;
+        for (int b = 0; b < nodes1D; ++b) {
+          double sval = 0.0;
+          for (int a = 0; a < nodes1D; ++a) {
+            sval += ls[a] * f[tensorNodeMap_[a + nodes1D * (b + nodes1D * c)]];
+          }
+          tval += lt[b] * sval;
+        }
+        val += lu[c] * tval;
+      }
+      result[comp] = val;
+    }
+  }
+
+  const std::vector<PointBlock>& blocks() const { return blocks_; }
+
+private:
+  std::vector<int> tensorNodeMap_;
+  std::vector<double> nodeLocations_;
+  std::vector<PointBlock> blocks_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -65,6 +65,7 @@ public:
 
   void set_current_ordinate_info(
       const int k);
+  void update_ordinate_intensity();
 
   void initialize_intensity();
   void compute_bc_intensity();
@@ -74,7 +75,6 @@ public:
   double provide_scaled_norm();
   double provide_norm();
 
-  void zero_out_fields();
   void zero_irradiation();
   
   void assemble_boundary_area();
@@ -110,7 +110,7 @@ public:
   const bool externalCoupling_;
   
   ScalarFieldType *intensity_;
-  ScalarFieldType *currentIntensity_;
+  GenericFieldType *intensityOrdinates_;
   ScalarFieldType *intensityBc_;
   ScalarFieldType *emissivity_;
   ScalarFieldType *transmissivity_;
@@ -134,6 +134,7 @@ public:
   
   bool isInit_;
   int ordinateDirections_;
+  int currentOrdinate_;
 
   // total set
   std::vector<double> Sn_;
@@ -35,6 +35,8 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  virtual AuxFunctionTimeDependence time_dependence() const { return AUX_TIME_STATIC; }
   
 private:
   double uzCenterline_;
@@ -37,6 +37,11 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  // the table is blended in over timeBlending_
+  virtual AuxFunctionTimeDependence time_dependence() const { return AUX_TIME_SEPARABLE; }
+  virtual double time_factor(const double time) const;
+  virtual double reference_time() const;
   
   // helper function to find the lower and upper bounds for the table
   void find_entry(
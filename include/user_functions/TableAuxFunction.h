@@ -36,6 +36,10 @@ public:
     const unsigned fieldSize,
     const unsigned beginPos,
     const unsigned endPos) const;
+
+  // tables in a coordinate direction do not change; tables in time are uniform in space
+  virtual AuxFunctionTimeDependence time_dependence() const {
+    return interpComp_ < 3 ? AUX_TIME_STATIC : AUX_TIME_GENERAL; }
   
   double interp(const std::pair<double,double> &x) const;
 
@@ -44,6 +48,9 @@ private:
   int interpComp_;
   int tableOffset_;
   std::vector<std::pair<double,double> > table_;
+
+  // upper end of the last interval found; successive lookups (in time) mostly hit it again
+  mutable size_t lastInterval_;
 };
 
 } // namespace nalu
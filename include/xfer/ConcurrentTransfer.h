@@ -0,0 +1,120 @@
+/*------------------------------------------------------------------------*/
+/*  Copyright 2014 Sandia Corporation.                                    */
+/*  This software is released under the license detailed                  */
+/*  in the file, LICENSE, which is located in the top-level Nalu          */
+/*  directory structure                                                   */
+/*------------------------------------------------------------------------*/
+
+
+#ifndef ConcurrentTransfer_h
+#define ConcurrentTransfer_h
+
+#include <stk_transfer/TransferBase.hpp>
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/EntityKey.hpp>
+#include <stk_search/IdentProc.hpp>
+#include <stk_util/parallel/Parallel.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// stk
+namespace stk {
+namespace mesh {
+class Part;
+typedef std::vector<Part*> PartVector;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+class FromMesh;
+class ToMesh;
+
+/** Transfer between realms that advance on disjoint processor groups
+ *
+ * The stk GeometricTransfer ghosts the sending elements into the receiving
+ * mesh and therefore needs both meshes on every rank. Here a rank holds at
+ * most one side of the pair: receiving points are searched against the
+ * sending elements over the coupling communicator (the union of both
+ * groups), the owner of the nearest element retains the isoparametric
+ * coordinates and each apply() ships interpolated values to the point owners.
+ */
+class ConcurrentTransfer : public stk::transfer::TransferBase
+{
+public:
+  typedef std::vector<std::pair<std::string, std::string> > PairNames;
+
+  // fromRealm/toRealm are NULL when that realm does not live on this rank
+  ConcurrentTransfer(
+    stk::ParallelMachine couplingComm,
+    Realm *fromRealm,
+    Realm *toRealm,
+    const stk::mesh::PartVector &fromPartVec,
+    const stk::mesh::PartVector &toPartVec,
+    const PairNames &transferVariablesPairName,
+    const double searchTolerance,
+    const double searchExpansionFactor,
+    const std::map<std::string, std::pair<double,double> > &clipMap);
+  virtual ~ConcurrentTransfer();
+
+  void coarse_search();
+  void communication() {}
+  void local_search();
+  void apply();
+
+  // ranks taking part in a transfer: those holding either realm
+  static int coupling_color(const bool fromActive, const bool toActive);
+
+  // receiving point -> (normalized distance, coupling rank) of the element owner serving it
+  typedef std::map<stk::mesh::EntityKey, std::pair<double, int> > OwnerMap;
+
+  // pair a receiving point with a candidate sending rank; nearest wins,
+  // ties go to the lower rank and points not found on that rank are ignored
+  static void select_owner(
+    OwnerMap &bestOwner,
+    const stk::mesh::EntityKey nodeKey,
+    const double bestX,
+    const int proc);
+
+private:
+  typedef std::pair<stk::search::IdentProc<stk::mesh::EntityKey, unsigned>,
+                    stk::search::IdentProc<stk::mesh::EntityKey, unsigned> > SearchPair;
+
+  // a receiving point served by an element owned on this rank
+  struct SendPoint {
+    stk::mesh::EntityKey nodeKey_;
+    stk::mesh::Entity elem_;
+    std::vector<double> isoParCoords_;
+    double bestX_;
+  };
+
+  void find_nearest_element(
+    const std::vector<double> &pointCoords,
+    const std::vector<stk::mesh::EntityKey> &elemKeys,
+    SendPoint &sendPoint) const;
+
+  stk::ParallelMachine couplingComm_;
+  int couplingRank_;
+  int couplingSize_;
+  const double searchExpansionFactor_;
+
+  std::shared_ptr<FromMesh> fromMesh_;
+  std::shared_ptr<ToMesh> toMesh_;
+
+  // receiving side; coarse search pairs for locally owned points
+  std::vector<SearchPair> searchPairs_;
+
+  // sending side; retained points, by coupling rank of the point owner
+  std::vector<std::vector<SendPoint> > sendPoints_;
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
@@ -12,6 +12,8 @@
 // yaml for parsing..
 #include <yaml-cpp/yaml.h>
 
+#include <mpi.h>
+
 #include <string>
 #include <vector>
 #include <utility>
@@ -48,6 +50,10 @@ public:
   void initialize_end();
   void execute();
 
+  // realms on disjoint processor groups; see ConcurrentTransfer
+  bool concurrent() const { return concurrent_; }
+  bool active_on_this_rank() const;
+
 
   Simulation *root();
   Transfers *parent();
@@ -62,6 +68,10 @@ public:
   Realm * fromRealm_;
   Realm * toRealm_;
 
+  // union of both processor groups; MPI_COMM_NULL on other ranks
+  bool concurrent_;
+  MPI_Comm couplingComm_;
+
   // during load
   std::string name_;
   std::string transferType_;
@@ -83,6 +93,7 @@ public:
   std::vector<std::pair<std::string, std::string> > transferVariablesPairName_;
 
   void allocate_stk_transfer();
+  void allocate_concurrent_transfer();
   void ghost_from_elements();
 };
 
@@ -37,6 +37,7 @@ public:
   void breadboard();
   void initialize();
   void execute(); // general method to execute all xfers (as apposed to Realm)
+  void execute_concurrent(const std::string transferObjective, const bool forcedXfer = false);
   Simulation *root();
   Simulation *parent();
 
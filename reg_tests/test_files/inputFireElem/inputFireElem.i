@@ -123,14 +123,7 @@ realms:
        - temperature
        - absorption_coefficient
        - intensity_bc
-       - intensity_0
-       - intensity_5
-       - intensity_10
-       - intensity_15
-       - intensity_20
-       - intensity_25
-       - intensity_30
-       - intensity_35
+       - intensity_ordinates
        - scalar_flux
        - radiative_heat_flux
        - radiation_source
@@ -91,13 +91,14 @@ public:
   }
 
   template<typename LambdaFunction>
-  void execute(LambdaFunction func)
+  void execute(LambdaFunction func, bool leanScratch = false)
   {
     int numDof = 1;
     STK_ThrowAssertMsg(partVec_.size()==1, "KokkosMEViews unit-test assumes partVec_.size==1");
 
     HelperObjects helperObjs(bulk_, AlgTraits::topo_, numDof, partVec_[0]);
     helperObjs.assembleElemSolverAlg->dataNeededByKernels_ = dataNeeded_;
+    helperObjs.assembleElemSolverAlg->leanScratch_ = leanScratch;
 
     helperObjs.assembleElemSolverAlg->run_algorithm(*bulk_, func);
   }
@@ -60,6 +60,30 @@ public:
     Kokkos::atomic_add(&numSumIntoCalls_, 1u);
   }
 
+  virtual void sumInto(
+      unsigned numEntities,
+      const stk::mesh::Entity* entities,
+      const sierra::nalu::SharedMemView<const DoubleType*> & simdrhs,
+      const sierra::nalu::SharedMemView<const DoubleType**> & simdlhs,
+      const int simdIndex,
+      const sierra::nalu::SharedMemView<int*> & localIds,
+      const sierra::nalu::SharedMemView<int*> & sortPermutation,
+      const char * trace_tag
+      )
+  {
+    if (numSumIntoCalls_ == 0) {
+      for(size_t i=0; i<simdrhs.extent(0); ++i) {
+        rhs_(i) = stk::simd::get_data(simdrhs(i), simdIndex);
+      }
+      for(size_t i=0; i<simdlhs.extent(0); ++i) {
+        for(size_t j=0; j<simdlhs.extent(1); ++j) {
+          lhs_(i,j) = stk::simd::get_data(simdlhs(i,j), simdIndex);
+        }
+      }
+    }
+    Kokkos::atomic_add(&numSumIntoCalls_, 1u);
+  }
+
   virtual void sumInto(
     const std::vector<stk::mesh::Entity> & sym_meshobj,
     std::vector<int> &scratchIds,
@@ -101,6 +125,10 @@ public:
   virtual int solve(stk::mesh::FieldBase * linearSolutionField) { return -1; }
   virtual void loadComplete() {}
 
+  virtual void setup_multiple_rhs(const unsigned numRhs) {}
+  virtual void store_rhs(const unsigned rhsIndex) {}
+  virtual int solve_multiple_rhs(stk::mesh::FieldBase * linearSolutionField) { return -1; }
+
   virtual void writeToFile(const char * filename, bool useOwned=true) {}
   virtual void writeSolutionToFile(const char * filename, bool useOwned=true) {}
 